@@ -0,0 +1,207 @@
+/*
+ * Author : Florian TORRES
+ * Date : October 2026
+ */
+
+#pragma once
+#ifndef __BVH__HPP
+#define __BVH__HPP
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <glimac/BBox.hpp>
+#include <gar/Blades.hpp>
+#include <gar/Scene.hpp>
+
+namespace gar {
+
+// Bounding volume hierarchy over the obstacles of a scene, built with the surface
+// area heuristic (half perimeters in 2D) and stored as a flat array of nodes in
+// depth-first order: the left child of a node follows it, the right child is
+// given by its offset. Queries only visit the obstacles whose bounding box
+// meets the query, e.g. the segment from a pixel to the light.
+template<typename T>
+class BVH {
+
+  public:
+    // Constructor
+    BVH() {}
+    explicit BVH(const Scene<T> &scene) { build(scene); }
+
+    // Build the hierarchy over the bounding boxes of the obstacles of the scene
+    void build(const Scene<T> &scene) {
+        _nodes.clear();
+        _indices.clear();
+        _unbounded.clear();
+
+        std::vector<glimac::BBox2f> boxes(scene.size());
+        std::vector<glm::vec2> centers(scene.size());
+        for (size_t o = 0; o < scene.size(); o++) {
+            if (scene.squaredRadius(o) <= 0) {
+                // Imaginary circle: no bounding box, always visited
+                _unbounded.push_back((unsigned int)o);
+                continue;
+            }
+            boxes[o] = glimac::BBox2f(glm::vec2(roundDown(scene.minX(o)), roundDown(scene.minY(o))),
+                                      glm::vec2(roundUp(scene.maxX(o)), roundUp(scene.maxY(o))));
+            centers[o] = glimac::center(boxes[o]);
+            _indices.push_back((unsigned int)o);
+        }
+        _nodes.reserve(2 * _indices.size());
+        if (!_indices.empty())
+            buildNode(boxes, centers, 0, _indices.size(), 0);
+    }
+
+    // Call f(o) on the obstacles whose bounding box meets the segment [a, b], until f returns false
+    template<typename F>
+    void forEachObstacleAlong(const Point<T> &a, const Point<T> &b, F f) const {
+        const glm::vec2 fa((float)a[1], (float)a[2]);
+        const glm::vec2 fb((float)b[1], (float)b[2]);
+        traverse([&](const glimac::BBox2f &box) { return glimac::conjoint(box, fa, fb); }, f);
+    }
+
+    // Call f(o) on the obstacles whose bounding box meets the box, until f returns false
+    template<typename F>
+    void forEachObstacleIn(const glimac::BBox2f &box, F f) const {
+        traverse([&](const glimac::BBox2f &nodeBox) { return glimac::conjoint(nodeBox, box); }, f);
+    }
+
+    // Getters
+    size_t size() const { return _nodes.size(); }
+
+  private:
+    struct Node {
+        glimac::BBox2f bounds;
+        unsigned int offset; // inner node: index of the right child, leaf: first obstacle in _indices
+        unsigned int count;  // number of obstacles of a leaf, 0 for an inner node
+    };
+
+    static const unsigned int nbBins = 16;
+    static const unsigned int maxLeafSize = 4;
+    static const unsigned int maxDepth = 48;
+
+    // Call f on the obstacles of the leaves whose nodes pass the test
+    template<typename Test, typename F>
+    void traverse(Test test, F f) const {
+        for (const unsigned int o : _unbounded)
+            if (!f(o))
+                return;
+        if (_nodes.empty())
+            return;
+        unsigned int stack[maxDepth + 1];
+        unsigned int stackSize = 0;
+        unsigned int n = 0;
+        while (true) {
+            const Node &node = _nodes[n];
+            if (test(node.bounds)) {
+                if (node.count == 0) {
+                    stack[stackSize++] = node.offset;
+                    n = n + 1;
+                    continue;
+                }
+                for (unsigned int i = node.offset; i < node.offset + node.count; i++)
+                    if (!f(_indices[i]))
+                        return;
+            }
+            if (stackSize == 0)
+                return;
+            n = stack[--stackSize];
+        }
+    }
+
+    // Build the node of the obstacles _indices[begin, end) and its children, returns its index
+    unsigned int buildNode(const std::vector<glimac::BBox2f> &boxes, const std::vector<glm::vec2> &centers,
+                           const size_t begin, const size_t end, const unsigned int depth) {
+        const unsigned int n = (unsigned int)_nodes.size();
+        _nodes.emplace_back();
+        glimac::BBox2f bounds = boxes[_indices[begin]];
+        glimac::BBox2f centerBounds(centers[_indices[begin]]);
+        for (size_t i = begin + 1; i < end; i++) {
+            bounds += boxes[_indices[i]];
+            centerBounds += centers[_indices[i]];
+        }
+        _nodes[n].bounds = bounds;
+
+        const size_t count = end - begin;
+        const glm::vec2 extent = centerBounds.size();
+        const int axis = extent.x >= extent.y ? 0 : 1;
+        size_t middle = begin;
+        if (count > maxLeafSize && depth < maxDepth && extent[axis] > 0.f)
+            middle = splitSAH(boxes, centers, begin, end, axis, centerBounds, halfPerimeter(bounds));
+
+        if (middle == begin) {
+            _nodes[n].offset = (unsigned int)begin;
+            _nodes[n].count = (unsigned int)count;
+            return n;
+        }
+        _nodes[n].count = 0;
+        buildNode(boxes, centers, begin, middle, depth + 1);
+        const unsigned int right = buildNode(boxes, centers, middle, end, depth + 1); // may reallocate _nodes
+        _nodes[n].offset = right;
+        return n;
+    }
+
+    // Partition _indices[begin, end) along the axis at the best bin boundary for the surface area heuristic,
+    // returns the first obstacle of the right side, or begin when a leaf is cheaper
+    size_t splitSAH(const std::vector<glimac::BBox2f> &boxes, const std::vector<glm::vec2> &centers,
+                    const size_t begin, const size_t end, const int axis, const glimac::BBox2f &centerBounds, const float parentHalfPerimeter) {
+        const float lower = centerBounds.lower[axis];
+        const float scale = nbBins / (centerBounds.upper[axis] - lower);
+        auto binOf = [&](const unsigned int o) {
+            return std::min(nbBins - 1, (unsigned int)((centers[o][axis] - lower) * scale));
+        };
+
+        glimac::BBox2f binBounds[nbBins];
+        unsigned int binCounts[nbBins] = {0};
+        for (size_t i = begin; i < end; i++) {
+            const unsigned int b = binOf(_indices[i]);
+            binBounds[b] = binCounts[b] ? glimac::merge(binBounds[b], boxes[_indices[i]]) : boxes[_indices[i]];
+            binCounts[b]++;
+        }
+
+        // Cost of the split after each bin: sweep from the right, then from the left
+        float rightCosts[nbBins];
+        glimac::BBox2f accumulated;
+        unsigned int accumulatedCount = 0;
+        for (unsigned int b = nbBins - 1; b > 0; b--) {
+            if (binCounts[b])
+                accumulated = accumulatedCount ? glimac::merge(accumulated, binBounds[b]) : binBounds[b];
+            accumulatedCount += binCounts[b];
+            rightCosts[b - 1] = accumulatedCount ? accumulatedCount * halfPerimeter(accumulated) : 0.f;
+        }
+        float bestCost = float(end - begin); // cost of a leaf, relative to the cost of traversing a node
+        unsigned int bestBin = nbBins;
+        accumulatedCount = 0;
+        for (unsigned int b = 0; b + 1 < nbBins; b++) {
+            if (binCounts[b])
+                accumulated = accumulatedCount ? glimac::merge(accumulated, binBounds[b]) : binBounds[b];
+            accumulatedCount += binCounts[b];
+            if (accumulatedCount == 0 || accumulatedCount == end - begin)
+                continue;
+            const float cost = 1.f + (accumulatedCount * halfPerimeter(accumulated) + rightCosts[b]) / parentHalfPerimeter;
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestBin = b;
+            }
+        }
+        if (bestBin == nbBins)
+            return begin;
+
+        const auto middle = std::partition(_indices.begin() + begin, _indices.begin() + end,
+                                           [&](const unsigned int o) { return binOf(o) <= bestBin; });
+        return middle - _indices.begin();
+    }
+
+    // Conversion to float of the bounds, rounded outwards so that the boxes stay conservative
+    static float roundDown(const T &x) { const float f = (float)x; return f > x ? std::nextafter(f, -INFINITY) : f; }
+    static float roundUp(const T &x) { const float f = (float)x; return f < x ? std::nextafter(f, INFINITY) : f; }
+
+    std::vector<Node> _nodes;
+    std::vector<unsigned int> _indices;   // obstacles, in the order of the leaves
+    std::vector<unsigned int> _unbounded; // obstacles without a bounding box
+};
+
+} // namespace gar
+
+#endif
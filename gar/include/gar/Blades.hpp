@@ -0,0 +1,255 @@
+/*
+ * Author : Florian TORRES
+ * Date : October 2026
+ */
+
+#pragma once
+#ifndef __BLADES__HPP
+#define __BLADES__HPP
+
+#include <array>
+#include <c2ga/Mvec.hpp>
+
+namespace gar {
+
+// Grade and sparsity typed blades of c2ga.
+// Each type only stores the coefficients that can be non-zero, so that the
+// products between them only compute the structurally non-zero terms.
+
+// Base class: fixed number of coefficients, converted to/from c2ga::Mvec
+// through the xor indices of the basis blades they correspond to.
+template<typename T, unsigned int N>
+class Blade {
+
+  public:
+    // Constructor
+    Blade() { _coeffs.fill(T(0)); }
+
+    // Getters
+    const T& operator[](const int i) const { return _coeffs[i]; }
+
+    // Setters
+    T& operator[](const int i) { return _coeffs[i]; }
+
+  protected:
+    c2ga::Mvec<T> toMvec(const std::array<unsigned int, N> &xorIndices) const {
+        c2ga::Mvec<T> mv;
+        for (unsigned int i = 0; i < N; i++)
+            if (_coeffs[i] != T(0))
+                mv[xorIndices[i]] = _coeffs[i];
+        return mv;
+    }
+
+    void fromMvec(const c2ga::Mvec<T> &mv, const std::array<unsigned int, N> &xorIndices) {
+        for (unsigned int i = 0; i < N; i++)
+            _coeffs[i] = mv[xorIndices[i]];
+    }
+
+    std::array<T, N> _coeffs;
+};
+
+// Vector (grade 1): a point, or the dual of a circle or a line.
+// Components on e0, e1, e2, ei.
+template<typename T>
+class Point : public Blade<T, 4> {
+
+  public:
+    // Constructor
+    Point() {}
+    Point(const T &x, const T &y) {
+        (*this)[0] = 1.0;
+        (*this)[1] = x;
+        (*this)[2] = y;
+        (*this)[3] = 0.5 * (x * x + y * y);
+    }
+    explicit Point(const c2ga::Mvec<T> &mv) { this->fromMvec(mv, xorIndices()); }
+
+    // Conversion
+    c2ga::Mvec<T> mvec() const { return this->toMvec(xorIndices()); }
+
+    static std::array<unsigned int, 4> xorIndices() { return {{c2ga::E0, c2ga::E1, c2ga::E2, c2ga::Ei}}; }
+};
+
+// Bivector (grade 2): a point pair, e.g. the intersection of a line and a circle.
+// Components on e01, e02, e0i, e12, e1i, e2i.
+template<typename T>
+class PointPair : public Blade<T, 6> {
+
+  public:
+    // Constructor
+    PointPair() {}
+    explicit PointPair(const c2ga::Mvec<T> &mv) { this->fromMvec(mv, xorIndices()); }
+
+    // Conversion
+    c2ga::Mvec<T> mvec() const { return this->toMvec(xorIndices()); }
+
+    static std::array<unsigned int, 6> xorIndices() { return {{c2ga::E01, c2ga::E02, c2ga::E0i, c2ga::E12, c2ga::E1i, c2ga::E2i}}; }
+};
+
+// Flat trivector (grade 3): a line, p1 ^ p2 ^ ei.
+// Its e012 component is always zero, the components are on e01i, e02i, e12i.
+template<typename T>
+class Line : public Blade<T, 3> {
+
+  public:
+    // Constructor
+    Line() {}
+    explicit Line(const c2ga::Mvec<T> &mv) { this->fromMvec(mv, xorIndices()); }
+
+    // Conversion
+    c2ga::Mvec<T> mvec() const { return this->toMvec(xorIndices()); }
+
+    static std::array<unsigned int, 3> xorIndices() { return {{c2ga::E01i, c2ga::E02i, c2ga::E12i}}; }
+};
+
+// Round trivector (grade 3): a circle.
+// Components on e012, e01i, e02i, e12i.
+template<typename T>
+class Circle : public Blade<T, 4> {
+
+  public:
+    // Constructor
+    Circle() {}
+    // Circle from center (x, y coords) and radius
+    Circle(const T &x, const T &y, const T &r) {
+        Point<T> dualCircle(x, y);
+        dualCircle[3] -= r * r * .5;
+        *this = !dualCircle;
+    }
+    explicit Circle(const c2ga::Mvec<T> &mv) { this->fromMvec(mv, xorIndices()); }
+
+    // Conversion
+    c2ga::Mvec<T> mvec() const { return this->toMvec(xorIndices()); }
+
+    static std::array<unsigned int, 4> xorIndices() { return {{c2ga::E012, c2ga::E01i, c2ga::E02i, c2ga::E12i}}; }
+};
+
+
+// Outer products
+
+// p1 ^ p2
+template<typename T>
+PointPair<T> operator^(const Point<T> &a, const Point<T> &b) {
+    PointPair<T> r;
+    r[0] = a[0]*b[1] - a[1]*b[0];
+    r[1] = a[0]*b[2] - a[2]*b[0];
+    r[2] = a[0]*b[3] - a[3]*b[0];
+    r[3] = a[1]*b[2] - a[2]*b[1];
+    r[4] = a[1]*b[3] - a[3]*b[1];
+    r[5] = a[2]*b[3] - a[3]*b[2];
+    return r;
+}
+
+// pp ^ p (circle through 3 points when pp = p1 ^ p2)
+template<typename T>
+Circle<T> operator^(const PointPair<T> &a, const Point<T> &b) {
+    Circle<T> r;
+    r[0] = a[0]*b[2] - a[1]*b[1] + a[3]*b[0];
+    r[1] = a[0]*b[3] - a[2]*b[1] + a[4]*b[0];
+    r[2] = a[1]*b[3] - a[2]*b[2] + a[5]*b[0];
+    r[3] = a[3]*b[3] - a[4]*b[2] + a[5]*b[1];
+    return r;
+}
+
+
+// Duals
+
+template<typename T>
+Circle<T> operator!(const Point<T> &a) {
+    Circle<T> r;
+    r[0] =  a[0];
+    r[1] =  a[2];
+    r[2] = -a[1];
+    r[3] = -a[3];
+    return r;
+}
+
+template<typename T>
+Point<T> operator!(const Circle<T> &a) {
+    Point<T> r;
+    r[0] = -a[0];
+    r[1] =  a[2];
+    r[2] = -a[1];
+    r[3] =  a[3];
+    return r;
+}
+
+template<typename T>
+Point<T> operator!(const Line<T> &a) {
+    Point<T> r;
+    r[1] =  a[1];
+    r[2] = -a[0];
+    r[3] =  a[2];
+    return r;
+}
+
+template<typename T>
+PointPair<T> operator!(const PointPair<T> &a) {
+    PointPair<T> r;
+    r[0] = -a[1];
+    r[1] =  a[0];
+    r[2] = -a[3];
+    r[3] =  a[2];
+    r[4] =  a[5];
+    r[5] = -a[4];
+    return r;
+}
+
+
+// Inner products
+
+template<typename T>
+T operator|(const Point<T> &a, const Point<T> &b) {
+    return -a[0]*b[3] + a[1]*b[1] + a[2]*b[2] - a[3]*b[0];
+}
+
+template<typename T>
+T operator|(const PointPair<T> &a, const PointPair<T> &b) {
+    return -a[0]*b[4] - a[1]*b[5] + a[2]*b[2] - a[3]*b[3] - a[4]*b[0] - a[5]*b[1];
+}
+
+template<typename T>
+T operator|(const Circle<T> &a, const Circle<T> &b) {
+    return a[0]*b[3] + a[1]*b[1] + a[2]*b[2] + a[3]*b[0];
+}
+
+template<typename T>
+Point<T> operator|(const PointPair<T> &a, const Point<T> &b) {
+    Point<T> r;
+    r[0] = a[0]*b[1] + a[1]*b[2] - a[2]*b[0];
+    r[1] = a[0]*b[3] + a[3]*b[2] - a[4]*b[0];
+    r[2] = a[1]*b[3] - a[3]*b[1] - a[5]*b[0];
+    r[3] = a[2]*b[3] - a[4]*b[1] - a[5]*b[2];
+    return r;
+}
+
+
+// Linear combinations of vectors
+
+template<typename T>
+Point<T> operator+(const Point<T> &a, const Point<T> &b) {
+    Point<T> r;
+    for (int i = 0; i < 4; i++)
+        r[i] = a[i] + b[i];
+    return r;
+}
+
+template<typename T>
+Point<T> operator-(const Point<T> &a, const Point<T> &b) {
+    Point<T> r;
+    for (int i = 0; i < 4; i++)
+        r[i] = a[i] - b[i];
+    return r;
+}
+
+template<typename T>
+Point<T> operator*(const T &s, const Point<T> &a) {
+    Point<T> r;
+    for (int i = 0; i < 4; i++)
+        r[i] = s * a[i];
+    return r;
+}
+
+} // namespace gar
+
+#endif
@@ -0,0 +1,153 @@
+/*
+ * Author : Florian TORRES
+ * Date : October 2026
+ */
+
+#pragma once
+#ifndef __RENDERER__HPP
+#define __RENDERER__HPP
+
+#include <vector>
+#include <memory>
+#include <glimac/glm.hpp>
+#include <gar/utils.hpp>
+#include <gar/Blades.hpp>
+#include <gar/Light.hpp>
+#include <gar/Scene.hpp>
+#include <gar/BVH.hpp>
+#include <gar/VisibilityMap.hpp>
+#include <gar/TaskPool.hpp>
+
+namespace gar {
+
+// Shading of the lit scene into a caller-provided RGBA buffer, without any window
+// or OpenGL context. The image is drawn progressively: each call to render draws
+// a given number of pixels, from a coarse grid to the full resolution, until the
+// whole image is done. Each pixel of a pass also covers the pixels of its block
+// that later passes will draw, so that the image is usable after the first pass.
+// The pixels are shaded in parallel on threads() threads of a persistent TaskPool.
+class Renderer {
+
+  public:
+    // Constructor
+    Renderer(const int width, const int height);
+
+    // Add an obstacle to the scene
+    void addObstacle(const Circle<Real> &c);
+
+    // Move the light (in pixels from the center of the image), the only way to move it
+    void setLightPosition(const glm::vec2 &pos);
+
+    // Set the radius of the light, clamped between 0 and its maximum size
+    void setLightSize(const float size);
+
+    // Set the factor applied to the shaded intensities
+    void setLightIntensity(const float intensity);
+
+    // Tell whether the light stays in place while images are drawn (e.g. offline renders). The obstacles
+    // that may shade a pixel are then read from a VisibilityMap of the light, rebuilt only when the light
+    // is moved (setLightPosition) or obstacles are added, instead of being searched in the BVH.
+    void setFixedLight(const bool fixedLight);
+
+    // Set the shadows: 0 for none, 1 for the basic shadows, 2 for the advanced shadows
+    void setShadows(const int shadows);
+
+    // Set the intensity of the pixels out of the light, and of the pixels in the obstacles far from the light
+    void setAmbientIntensity(const float ambientIntensity);
+    void setInObstacleColor(const float inObstacleColor);
+
+    // Set the number of threads of the pool (0: one per core), the pool is created again
+    void setThreads(const int threads);
+
+    // Set the side of the tiles of renderAll, in pixels
+    void setTileSize(const int tileSize);
+
+    // Start the image again, e.g. after a change of the scene or of the settings
+    void restart();
+
+    // Draw the next nbPixels pixels of the image into pixels (width * height RGBA colors, row by row).
+    // The buffer is cleared when a new image starts. Returns true when the image is complete.
+    // The pixels of a call are drawn row by row, pass by pass: first every coarsestStep pixels in
+    // both directions, then the pixels halfway between them, and so on down to every pixel.
+    bool render(glm::vec4 *pixels, const int nbPixels);
+
+    // Draw the whole image into pixels, tile by tile: the tiles lit by the light
+    // and crossed by a shadow boundary first, then the other lit tiles, then the rest
+    void renderAll(glm::vec4 *pixels);
+
+    // Getters
+    int width() const { return _width; }
+    int height() const { return _height; }
+    bool isComplete() const { return _progress >= _width * _height; }
+    const Light& light() const { return _light; }
+    const float& lightIntensity() const { return _lightIntensity; }
+    bool fixedLight() const { return _fixedLight; }
+    const Scene<Real>& scene() const { return _scene; }
+    const int& shadows() const { return _shadows; }
+    const float& ambientIntensity() const { return _ambientIntensity; }
+    const float& inObstacleColor() const { return _inObstacleColor; }
+    const int& threads() const { return _threads; }
+    const int& tileSize() const { return _tileSize; }
+
+  private:
+    // Intensity of the light at the pixel, candidates is a work buffer of the calling thread
+    float shade(const Point<Real> &pixel, std::vector<unsigned int> &candidates) const;
+
+    // Shade the pixel (row, column) into the size x size block of pixels starting at it
+    void shadePixel(const int row, const int column, const int size, glm::vec4 *pixels, std::vector<unsigned int> &candidates) const;
+
+    // Number of threads to use
+    unsigned int nbThreads() const;
+
+    // Pool of nbThreads() threads, created at the first use
+    TaskPool& pool();
+
+    // Create the pool again with nbThreads() threads
+    void resetPool();
+
+    // Order in which the tiles of renderAll are started: 0 for the tiles lit by the light and crossed
+    // by a shadow boundary (near an obstacle, or partly in the shadow), 1 for the other lit tiles, 2 otherwise
+    int tilePriority(const int row0, const int column0, const int row1, const int column1) const;
+
+    // Position (row, column) of the k-th pixel of the pass, computed from k: the drawing order is not stored
+    glm::ivec2 pixelPosition(const int pass, const int k) const;
+
+    // Is the point in the shadow of an obstacle (basic shadows)
+    bool isInShadow(const Point<Real> &p) const;
+
+    // Build the BVH if obstacles were added since the last build, and the visibility map
+    // if the light is fixed and moved or obstacles were added since the last build
+    void updateSearchStructures();
+
+    int _width;
+    int _height;
+    Light _light;
+    float _lightIntensity;
+    Point<Real> _lightPosition;
+    Scene<Real> _scene;
+    BVH<Real> _bvh;
+    bool _bvhOutdated;
+    VisibilityMap<Real> _visibilityMap;
+    bool _fixedLight;
+    bool _visibilityMapOutdated;
+
+    int _shadows; // 0: No shadows, 1: Basic shadows, 2: Advanced shadows
+    float _ambientIntensity;
+    float _inObstacleColor;
+    float _nearShadowDistance; // Advanced shadows: size of the shadow near the obstacles
+
+    int _threads;
+    int _tileSize; // renderAll: side of the square tiles shared among the threads, in pixels
+    std::unique_ptr<TaskPool> _pool;
+    std::vector<std::vector<unsigned int>> _candidates; // work buffer of each thread of the pool
+    std::vector<unsigned int> _tiles; // renderAll: tiles in priority order
+
+    static const int coarsestStep = 8; // render: distance between the pixels of the first pass
+
+    std::vector<int> _passesEnds; // number of pixels drawn at the end of each pass
+    int _progress; // number of pixels of the current image already drawn
+};
+
+} // namespace gar
+
+#endif
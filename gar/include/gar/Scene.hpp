@@ -0,0 +1,116 @@
+/*
+ * Author : Florian TORRES
+ * Date : October 2026
+ */
+
+#pragma once
+#ifndef __SCENE__HPP
+#define __SCENE__HPP
+
+#include <vector>
+#include <gar/Blades.hpp>
+#include <gar/c2gaTools.hpp>
+
+namespace gar {
+
+// Obstacles of the scene (circles) with the data that does not depend on the pixel:
+// dual circle, center, squared radius and bounding box, computed once when an
+// obstacle is added, and the shadow wedges, computed once per light position.
+// Stored as one array per field, so that a loop over the obstacles only reads
+// the fields it uses.
+template<typename T>
+class Scene {
+
+  public:
+    // Constructor
+    Scene() {}
+
+    // Add an obstacle and precompute its data
+    void addObstacle(const Circle<T> &c) {
+        _obstacles.push_back(c);
+        _duals.push_back(!c);
+        _centers.emplace_back();
+        _squaredRadii.emplace_back();
+        _minX.emplace_back();
+        _minY.emplace_back();
+        _maxX.emplace_back();
+        _maxY.emplace_back();
+        _wedges.emplace_back();
+        update(_obstacles.size() - 1);
+    }
+
+    // Move the light and update the shadow wedges of the obstacles
+    void setLight(const Point<T> &light) {
+        _light = light;
+        for (size_t i = 0; i < _obstacles.size(); i++)
+            _wedges[i] = gar::shadowWedge(_light, _obstacles[i], _centers[i]);
+    }
+
+    // Remove all the obstacles
+    void clear() {
+        _obstacles.clear();
+        _duals.clear();
+        _centers.clear();
+        _squaredRadii.clear();
+        _minX.clear();
+        _minY.clear();
+        _maxX.clear();
+        _maxY.clear();
+        _wedges.clear();
+    }
+
+    // Apply a versor (see translator, rotor, dilator) to all the obstacles and update their data
+    void applyVersor(const Mvec<T> &versor) {
+        gar::applyVersor(versor, _obstacles);
+        for (size_t i = 0; i < _obstacles.size(); i++) {
+            _duals[i] = !_obstacles[i];
+            update(i);
+        }
+    }
+
+    // Getters
+    size_t size() const { return _obstacles.size(); }
+    const std::vector<Circle<T>>& obstacles() const { return _obstacles; }
+    const Circle<T>& obstacle(const size_t i) const { return _obstacles[i]; }
+    const Point<T>& dualObstacle(const size_t i) const { return _duals[i]; }
+    const Point<T>& center(const size_t i) const { return _centers[i]; }
+    const T& squaredRadius(const size_t i) const { return _squaredRadii[i]; }
+    const T& minX(const size_t i) const { return _minX[i]; }
+    const T& minY(const size_t i) const { return _minY[i]; }
+    const T& maxX(const size_t i) const { return _maxX[i]; }
+    const T& maxY(const size_t i) const { return _maxY[i]; }
+    const Point<T>& light() const { return _light; }
+    const ShadowWedge<T>& shadowWedge(const size_t i) const { return _wedges[i]; }
+
+  private:
+    // Compute the data of the obstacle i from its dual circle
+    void update(const size_t i) {
+        const Point<T> &d = _duals[i];
+        const T x = d[1] / d[0];
+        const T y = d[2] / d[0];
+        const T r2 = (d | d) / (d[0] * d[0]); // the dual circle normalized is the center minus r^2/2 ei
+        const T r = sqrt(fabs(r2));
+        _centers[i] = Point<T>(x, y);
+        _squaredRadii[i] = r2;
+        _minX[i] = x - r;
+        _minY[i] = y - r;
+        _maxX[i] = x + r;
+        _maxY[i] = y + r;
+        _wedges[i] = gar::shadowWedge(_light, _obstacles[i], _centers[i]);
+    }
+
+    std::vector<Circle<T>> _obstacles;
+    std::vector<Point<T>> _duals;
+    std::vector<Point<T>> _centers;
+    std::vector<T> _squaredRadii;
+    std::vector<T> _minX;
+    std::vector<T> _minY;
+    std::vector<T> _maxX;
+    std::vector<T> _maxY;
+    Point<T> _light = Point<T>(T(0), T(0));
+    std::vector<ShadowWedge<T>> _wedges;
+};
+
+} // namespace gar
+
+#endif
@@ -0,0 +1,71 @@
+/*
+ * Author : Florian TORRES
+ * Date : October 2026
+ */
+
+#pragma once
+#ifndef __TASKPOOL__HPP
+#define __TASKPOOL__HPP
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace gar {
+
+// Persistent pool of threads running batches of tasks, reused from one frame to
+// the next. Each thread has its own queue of tasks; a thread whose queue is empty
+// steals the tasks of the others, so that uneven tasks (e.g. tiles near many
+// obstacles) do not leave the other threads idle.
+class TaskPool {
+
+  public:
+    // Constructor: nbThreads threads in total, the thread calling run being one of them
+    explicit TaskPool(const unsigned int nbThreads);
+    ~TaskPool();
+
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    // Call f(task, thread) on the tasks 0 to nbTasks - 1, started in this order as far as possible,
+    // thread being the index of the calling thread in the pool. Returns when all the tasks are done.
+    void run(const unsigned int nbTasks, const std::function<void(unsigned int, unsigned int)> &f);
+
+    // Getters
+    unsigned int size() const { return (unsigned int)_queues.size(); }
+
+  private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<unsigned int> tasks;
+    };
+
+    // Loop of the thread, waiting for the batches
+    void wait(const unsigned int thread);
+
+    // Run the tasks of the queue of the thread, then the ones stolen from the other queues
+    void work(const unsigned int thread);
+
+    // Take the next task of the queue of the thread, or the last task of another queue
+    bool pop(const unsigned int thread, unsigned int &task);
+    bool steal(const unsigned int thread, unsigned int &task);
+
+    std::vector<std::unique_ptr<Queue>> _queues;
+    std::vector<std::thread> _threads;
+
+    std::mutex _mutex;
+    std::condition_variable _started;
+    std::condition_variable _finished;
+    const std::function<void(unsigned int, unsigned int)> *_f; // tasks of the current batch
+    unsigned int _batch;   // index of the current batch
+    unsigned int _working; // threads of the pool still working on the current batch
+    bool _stop;
+};
+
+} // namespace gar
+
+#endif
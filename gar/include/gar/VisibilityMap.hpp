@@ -0,0 +1,170 @@
+/*
+ * Author : Florian TORRES
+ * Date : October 2026
+ */
+
+#pragma once
+#ifndef __VISIBILITYMAP__HPP
+#define __VISIBILITYMAP__HPP
+
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <math.h>
+#include <gar/Blades.hpp>
+#include <gar/Scene.hpp>
+
+namespace gar {
+
+// Angular map of the obstacles seen from the light, rebuilt when the light moves.
+// The angles around the light are split into intervals in which the set of
+// obstacles crossed by the rays from the light does not change. For each
+// interval, it stores these obstacles (in increasing index order) and the
+// nearest distance from the light at which a ray can enter one of them.
+// A pixel then only tests the obstacles of the interval of its angle, found
+// with a binary search, instead of all the obstacles of the scene.
+template<typename T>
+class VisibilityMap {
+
+  public:
+    // Constructor
+    VisibilityMap() {}
+    explicit VisibilityMap(const Scene<T> &scene) { build(scene); }
+
+    // Compute the intervals from the obstacles and the light of the scene
+    void build(const Scene<T> &scene) {
+        _light = scene.light();
+        _bounds.clear();
+        _near.clear();
+        _offsets.clear();
+        _obstacles.clear();
+
+        // Angular range [first, last] of each obstacle, split in two if it wraps around -pi
+        std::vector<T> first, last, near;
+        std::vector<unsigned int> index;
+        for (size_t o = 0; o < scene.size(); o++) {
+            const Point<T> &center = scene.center(o);
+            const T squaredDistanceToCenter = squaredDistance(_light, center);
+            const T squaredRadius = scene.squaredRadius(o);
+            if (scene.shadowWedge(o).lightInside || squaredRadius <= 0 || squaredRadius >= squaredDistanceToCenter) {
+                // Every ray from the light may cross it
+                addRange(first, last, near, index, -T(M_PI), T(M_PI), T(0), o);
+                continue;
+            }
+            const T distanceToCenter = sqrt(squaredDistanceToCenter);
+            const T radius = sqrt(squaredRadius);
+            const T angle = atan2(center[2] - _light[2], center[1] - _light[1]);
+            const T halfAperture = asin(radius / distanceToCenter) + angleEpsilon(); // rays on the tangents are kept
+            const T lo = angle - halfAperture;
+            const T hi = angle + halfAperture;
+            if (lo < -T(M_PI)) {
+                addRange(first, last, near, index, lo + T(2 * M_PI), T(M_PI), distanceToCenter - radius, o);
+                addRange(first, last, near, index, -T(M_PI), hi, distanceToCenter - radius, o);
+            } else if (hi > T(M_PI)) {
+                addRange(first, last, near, index, lo, T(M_PI), distanceToCenter - radius, o);
+                addRange(first, last, near, index, -T(M_PI), hi - T(2 * M_PI), distanceToCenter - radius, o);
+            } else {
+                addRange(first, last, near, index, lo, hi, distanceToCenter - radius, o);
+            }
+        }
+
+        // Bounds of the intervals: all the ends of the ranges, from -pi to pi
+        _bounds.push_back(-T(M_PI));
+        _bounds.insert(_bounds.end(), first.begin(), first.end());
+        _bounds.insert(_bounds.end(), last.begin(), last.end());
+        _bounds.push_back(T(M_PI));
+        std::sort(_bounds.begin(), _bounds.end());
+        _bounds.erase(std::unique(_bounds.begin(), _bounds.end()), _bounds.end());
+        const size_t nbIntervals = _bounds.size() - 1;
+
+        // Interval k = [_bounds[k], _bounds[k + 1]] of each range
+        std::vector<size_t> firstInterval(first.size()), lastInterval(first.size());
+        for (size_t r = 0; r < first.size(); r++) {
+            firstInterval[r] = std::lower_bound(_bounds.begin(), _bounds.end(), first[r]) - _bounds.begin();
+            lastInterval[r] = std::lower_bound(_bounds.begin(), _bounds.end(), last[r]) - _bounds.begin();
+        }
+
+        // Obstacles of each interval, stored contiguously: count, then fill
+        _near.assign(nbIntervals, std::numeric_limits<T>::max());
+        _offsets.assign(nbIntervals + 1, 0);
+        for (size_t r = 0; r < first.size(); r++)
+            for (size_t k = firstInterval[r]; k < lastInterval[r]; k++) {
+                _offsets[k + 1]++;
+                _near[k] = std::min(_near[k], near[r]);
+            }
+        for (size_t k = 0; k < nbIntervals; k++)
+            _offsets[k + 1] += _offsets[k];
+        _obstacles.resize(_offsets[nbIntervals]);
+        std::vector<unsigned int> filled(_offsets.begin(), _offsets.end() - 1);
+        for (size_t r = 0; r < first.size(); r++) // ranges are in increasing obstacle order
+            for (size_t k = firstInterval[r]; k < lastInterval[r]; k++)
+                _obstacles[filled[k]++] = index[r];
+    }
+
+    // Get the interval of the angle of the point seen from the light
+    size_t interval(const Point<T> &p) const {
+        return interval(atan2(p[2] - _light[2], p[1] - _light[1]));
+    }
+
+    // Get the interval of the opposite direction, i.e. the obstacles crossed by the line
+    // through the light and the point on the other side of the light
+    size_t oppositeInterval(const Point<T> &p) const {
+        return interval(atan2(_light[2] - p[2], _light[1] - p[1]));
+    }
+
+    // Get the interval of an angle in [-pi, pi]
+    size_t interval(const T &angle) const {
+        const size_t k = std::upper_bound(_bounds.begin() + 1, _bounds.end() - 1, angle) - _bounds.begin();
+        return k - 1;
+    }
+
+    // Getters
+    size_t size() const { return _near.size(); }
+    // Distance from the light under which no point of the interval is in or behind an obstacle
+    const T& near(const size_t k) const { return _near[k]; }
+    // Indices of the obstacles of the interval (see Scene), in increasing order
+    const unsigned int* begin(const size_t k) const { return _obstacles.data() + _offsets[k]; }
+    const unsigned int* end(const size_t k) const { return _obstacles.data() + _offsets[k + 1]; }
+
+    // Call f(o) on the obstacles of the intervals k1 and k2 in increasing order, each obstacle once,
+    // until f returns false
+    template<typename F>
+    void forEachObstacle(const size_t k1, const size_t k2, F f) const {
+        const unsigned int *it1 = begin(k1), *end1 = end(k1);
+        const unsigned int *it2 = begin(k2), *end2 = (k1 == k2) ? it2 : end(k2);
+        while (it1 != end1 || it2 != end2) {
+            unsigned int o;
+            if (it2 == end2 || (it1 != end1 && *it1 < *it2))
+                o = *it1++;
+            else if (it1 == end1 || *it2 < *it1)
+                o = *it2++;
+            else {
+                o = *it1++;
+                it2++;
+            }
+            if (!f(o))
+                return;
+        }
+    }
+
+  private:
+    static void addRange(std::vector<T> &first, std::vector<T> &last, std::vector<T> &near, std::vector<unsigned int> &index,
+                         const T &lo, const T &hi, const T &distance, const size_t o) {
+        first.push_back(std::max(lo, -T(M_PI)));
+        last.push_back(std::min(hi, T(M_PI)));
+        near.push_back(distance);
+        index.push_back((unsigned int)o);
+    }
+
+    static T angleEpsilon() { return T(1e-4); }
+
+    Point<T> _light;
+    std::vector<T> _bounds;               // from -pi to pi, interval k is [_bounds[k], _bounds[k + 1]]
+    std::vector<T> _near;                 // per interval
+    std::vector<unsigned int> _offsets;   // obstacles of the interval k are _obstacles[_offsets[k]] to _obstacles[_offsets[k + 1] - 1]
+    std::vector<unsigned int> _obstacles;
+};
+
+} // namespace gar
+
+#endif
@@ -7,6 +7,15 @@
 #ifndef __C2GATOOLS__HPP
 #define __C2GATOOLS__HPP
 
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <cassert>
+#include <c2ga/MvecExpression.hpp>
+#include <c2ga/BasisVector.hpp>
+#include <c2ga/Versor.hpp>
+#include <gar/Blades.hpp>
+
 using namespace c2ga;
 
 namespace gar {
@@ -25,14 +34,14 @@ Mvec<T> point(const T &x, const T &y){
 }
 
 // Create point from vec2
-Mvec<double> point(glm::vec2 &vec){
+inline Mvec<double> point(glm::vec2 &vec){
 	return point((double) vec.x, (double) vec.y);
 }
 
 // Create line from two points
 template<typename T>
 Mvec<T> line(const Mvec<T> &p1, const Mvec<T> &p2) {
-	return p1 ^ p2 ^ ei<T>();
+	return (p1 ^ p2) ^ basis::ei;
 }
 
 // Create line from equation ax + by + c = 0
@@ -52,19 +61,20 @@ Mvec<T> circle(const T &x, const T &y, const T &r) {
 // Normalize multivector
 template<typename T>
 Mvec<T> normalize(const Mvec<T> &mv) {
-	return -mv / (mv | ei<double>());
+	return -lazy(mv) / (mv | basis::ei);
 }
 
 // Get intersection between to multivectors
 template<typename T>
 Mvec<T> getIntersection(const Mvec<T> &mv1, const Mvec<T> &mv2) {
-	return !((!mv1) ^ (!mv2)); // Intersection
+	return mv1.meet(mv2); // Intersection = !((!mv1) ^ (!mv2))
 }
 
 // Returns true if the two multivectors are intersected
 template<typename T>
 bool areIntersected(const Mvec<T> &mv1, const Mvec<T> &mv2) {
-	return (T)(getIntersection(mv1, mv2) | getIntersection(mv1, mv2)) > 0;
+	const Mvec<T> pp = getIntersection(mv1, mv2);
+	return (T)pp.scalarProduct(pp) > 0;
 }
 
 // Returns true if the point p is in circle c
@@ -83,19 +93,19 @@ Mvec<T> projectPointOnLine(const Mvec<T> &p, const Mvec<T> &l) {
 // Get the center (a point) of the circle
 template<typename T>
 Mvec<T> getCenterOfCircle(const Mvec<T> &circle) {
-	return -circle / (ei<T>() < circle);
+	return -lazy(circle) / (basis::ei < circle);
 }
 
 // Get the first point from a point pair
 template<typename T>
 Mvec<T> getFirstPointFromPointPair(const Mvec<T> &pp) {
-	return (pp + sqrt(pp*pp)) / (-ei<T>() | pp);
+	return (lazy(pp) + sqrt(pp*pp)) / -(basis::ei | pp);
 }
 
 // Get the second point from a point pair
 template<typename T>
 Mvec<T> getSecondPointFromPointPair(const Mvec<T> &pp) {
-	return (pp - sqrt(pp*pp)) / (-ei<T>() | pp);
+	return (lazy(pp) - sqrt(pp*pp)) / -(basis::ei | pp);
 }
 
 // Project a point on a circle and returns the projection
@@ -110,6 +120,312 @@ float distance(const Mvec<T> &p1, const Mvec<T> &p2) {
 	return (p2 - p1).norm();
 }
 
+// Get the squared distance between two normalized points: -2 p1.p2
+// Cheaper than distance for comparisons, no difference nor square root.
+template<typename T>
+T squaredDistance(const Mvec<T> &p1, const Mvec<T> &p2) {
+	return T(-2) * (T)p1.scalarProduct(p2);
+}
+
+// Create translator of vector (x, y): 1 - 0.5 * t ei
+template<typename T>
+Mvec<T> translator(const T &x, const T &y) {
+	return T(1) - T(.5) * ((x * e1<T>() + y * e2<T>()) ^ basis::ei);
+}
+
+// Create rotor of angle a (radians, counterclockwise) around the origin
+template<typename T>
+Mvec<T> rotor(const T &a) {
+	return cos(a * .5) - sin(a * .5) * e12<T>();
+}
+
+// Create dilator of factor s around the origin
+template<typename T>
+Mvec<T> dilator(const T &s) {
+	T l = log(s) * .5;
+	return cosh(l) + sinh(l) * e0i<T>();
+}
+
+
+/*
+ * Grade typed versions (see Blades.hpp), computing only the non-zero coefficients
+ */
+
+// Create line from two points (p1 ^ p2 ^ ei)
+template<typename T>
+Line<T> line(const Point<T> &p1, const Point<T> &p2) {
+	Line<T> l;
+	l[0] = p1[0]*p2[1] - p1[1]*p2[0];
+	l[1] = p1[0]*p2[2] - p1[2]*p2[0];
+	l[2] = p1[1]*p2[2] - p1[2]*p2[1];
+	return l;
+}
+
+// Get intersection between a line and a circle (!((!l) ^ (!c)))
+template<typename T>
+PointPair<T> getIntersection(const Line<T> &l, const Circle<T> &c) {
+	PointPair<T> pp;
+	pp[0] =  l[0]*c[0];
+	pp[1] =  l[1]*c[0];
+	pp[2] = -l[0]*c[2] + l[1]*c[1];
+	pp[3] =  l[2]*c[0];
+	pp[4] = -l[0]*c[3] + l[2]*c[1];
+	pp[5] = -l[1]*c[3] + l[2]*c[2];
+	return pp;
+}
+
+// Get intersection between a circle and a line (!((!c) ^ (!l)))
+template<typename T>
+PointPair<T> getIntersection(const Circle<T> &c, const Line<T> &l) {
+	PointPair<T> pp;
+	pp[0] = -c[0]*l[0];
+	pp[1] = -c[0]*l[1];
+	pp[2] = -c[1]*l[1] + c[2]*l[0];
+	pp[3] = -c[0]*l[2];
+	pp[4] = -c[1]*l[2] + c[3]*l[0];
+	pp[5] = -c[2]*l[2] + c[3]*l[1];
+	return pp;
+}
+
+// Get intersection between two circles
+template<typename T>
+PointPair<T> getIntersection(const Circle<T> &c1, const Circle<T> &c2) {
+	PointPair<T> pp;
+	pp[0] = -c1[0]*c2[1] + c1[1]*c2[0];
+	pp[1] = -c1[0]*c2[2] + c1[2]*c2[0];
+	pp[2] = -c1[1]*c2[2] + c1[2]*c2[1];
+	pp[3] = -c1[0]*c2[3] + c1[3]*c2[0];
+	pp[4] = -c1[1]*c2[3] + c1[3]*c2[1];
+	pp[5] = -c1[2]*c2[3] + c1[3]*c2[2];
+	return pp;
+}
+
+// Get intersection between two lines (a flat point: only the e0i, e1i, e2i components)
+template<typename T>
+PointPair<T> getIntersection(const Line<T> &l1, const Line<T> &l2) {
+	PointPair<T> pp;
+	pp[2] = -l1[0]*l2[1] + l1[1]*l2[0];
+	pp[4] = -l1[0]*l2[2] + l1[2]*l2[0];
+	pp[5] = -l1[1]*l2[2] + l1[2]*l2[1];
+	return pp;
+}
+
+// Returns true if the point pair is made of two real points
+template<typename T>
+bool isRealPointPair(const PointPair<T> &pp) {
+	return (pp | pp) > 0;
+}
+
+// Returns true if the line and the circle are intersected
+template<typename T>
+bool areIntersected(const Line<T> &l, const Circle<T> &c) {
+	return isRealPointPair(getIntersection(l, c));
+}
+
+// Returns true if the point p is in circle c
+template<typename T>
+bool isPointInCircle(const Point<T> &p, const Circle<T> &c) {
+	T distToCircle = p[0]*c[3] - p[1]*c[2] + p[2]*c[1] - p[3]*c[0]; // (!p) | c
+	return distToCircle > 0;
+}
+
+// Get the center (a normalized point) of the circle, read from its dual
+template<typename T>
+Point<T> getCenterOfCircle(const Circle<T> &c) {
+	Point<T> dualCircle = !c;
+	return Point<T>(dualCircle[1] / dualCircle[0], dualCircle[2] / dualCircle[0]);
+}
+
+// Get one point from a point pair : (pp + s) / (-ei | pp) with s = +-sqrt(pp.pp)
+// The grade 3 part of this quotient vanishes since pp is a blade.
+template<typename T>
+Point<T> getPointFromPointPair(const PointPair<T> &pp, const T &s) {
+	Point<T> v; // -ei | pp
+	v[1] = pp[0];
+	v[2] = pp[1];
+	v[3] = pp[2];
+	const T n = v | v;
+	// n = 4 (pp.pp) / d^2 with d the distance between the points, it only vanishes for a point at infinity.
+	// A point pair has no other length to compare d with, so the test is scale free: no fixed epsilon,
+	// see intersectLineCircle for a test relative to the circle.
+	const T invN = T(1) / n;
+	if (!(n > T(0)) || !std::isfinite(invN))
+		return Point<T>();
+	return invN * ((pp | v) + s * v);
+}
+
+// Get the first point from a point pair
+template<typename T>
+Point<T> getFirstPointFromPointPair(const PointPair<T> &pp) {
+	return getPointFromPointPair(pp, T(sqrt(pp | pp)));
+}
+
+// Get the second point from a point pair
+template<typename T>
+Point<T> getSecondPointFromPointPair(const PointPair<T> &pp) {
+	return getPointFromPointPair(pp, T(-sqrt(pp | pp)));
+}
+
+// Intersection points of a line and a circle
+template<typename T>
+struct LineCircleIntersection {
+	bool intersected = false; // true if the line and the circle cross at two real, finite points; first and second are only set then
+	Point<T> first;           // first point of the point pair, see getFirstPointFromPointPair
+	Point<T> second;          // second point of the point pair, see getSecondPointFromPointPair
+};
+
+// Intersect a line and a circle and extract both points at once:
+// the point pair, its discriminant pp.pp, its square root and -ei | pp
+// are computed only once for both points.
+template<typename T>
+LineCircleIntersection<T> intersectLineCircle(const Line<T> &l, const Circle<T> &c) {
+	LineCircleIntersection<T> inter;
+	const PointPair<T> pp = getIntersection(l, c);
+	const T discriminant = pp | pp;
+	inter.intersected = discriminant > 0;
+	if (!inter.intersected)
+		return inter;
+
+	Point<T> v; // -ei | pp
+	v[1] = pp[0];
+	v[2] = pp[1];
+	v[3] = pp[2];
+	const T n = v[1]*v[1] + v[2]*v[2]; // v | v = 4 (pp.pp) / d^2, d the distance between the points
+	// Both points are on the circle, so d <= 2 r, i.e. n r^2 >= pp.pp, whatever the scale of the scene and
+	// the weights of l and c. Far below this bound (d > 4 r), -ei | pp is only rounding errors, e.g. for a
+	// line without direction: the points cannot be extracted, reported as no intersection.
+	const Point<T> dualCircle = !c; // r^2 = (dualCircle | dualCircle) / dualCircle[0]^2
+	if (!(n > T(0)) || n * (dualCircle | dualCircle) < T(.25) * discriminant * dualCircle[0] * dualCircle[0]) {
+		inter.intersected = false;
+		return inter;
+	}
+
+	const T invN = T(1) / n;
+	const T s = sqrt(discriminant);
+	const Point<T> ppv = pp | v;
+	for (int i = 0; i < 4; i++) {
+		inter.first[i]  = invN * (ppv[i] + s * v[i]);
+		inter.second[i] = invN * (ppv[i] - s * v[i]);
+	}
+	return inter;
+}
+
+// Project a point on a circle of known center (see Scene) and returns the projection
+template<typename T>
+Point<T> projectPointOnCircle(const Point<T> &p, const Circle<T> &c, const Point<T> &center) {
+	return getFirstPointFromPointPair(getIntersection(c, line(p, center)));
+}
+
+// Project a point on a circle and returns the projection
+template<typename T>
+Point<T> projectPointOnCircle(const Point<T> &p, const Circle<T> &c) {
+	return projectPointOnCircle(p, c, getCenterOfCircle(c));
+}
+
+// Is the point normalized (e0 coefficient 1), up to the rounding errors
+template<typename T>
+bool isNormalized(const Point<T> &p) {
+	return fabs(p[0] - T(1)) <= sqrt(std::numeric_limits<T>::epsilon());
+}
+
+// Get the squared distance between two normalized points, see squaredDistance(Mvec, Mvec)
+template<typename T>
+T squaredDistance(const Point<T> &p1, const Point<T> &p2) {
+	assert(isNormalized(p1) && isNormalized(p2));
+	return T(-2) * (p1 | p2);
+}
+
+// Get the distance between two normalized points
+template<typename T>
+T distance(const Point<T> &p1, const Point<T> &p2) {
+	return sqrt(fabs(squaredDistance(p1, p2)));
+}
+
+// Half-plane bounded by a line: the points p with a x + b y + c > 0,
+// i.e. p | !l up to the sign, oriented so that a given point is inside
+template<typename T>
+struct HalfPlane {
+	T a = T(0);
+	T b = T(0);
+	T c = T(0);
+
+	HalfPlane() {}
+	HalfPlane(const Line<T> &l, const Point<T> &inside) : a(l[1]), b(-l[0]), c(-l[2]) {
+		if ((*this)(inside) < 0) {
+			a = -a;
+			b = -b;
+			c = -c;
+		}
+	}
+
+	// Signed distance (up to a positive factor) of the point to the line, positive inside
+	T operator()(const Point<T> &p) const { return a * p[1] + b * p[2] + c * p[0]; }
+};
+
+// Shadow cast by a circle lit by a point light: the wedge between the two tangents
+// from the light to the circle, beyond the chord joining the tangent points.
+// Computed once per light position, then each test is a few dot products.
+template<typename T>
+struct ShadowWedge {
+	bool lightInside = false; // the light is in the circle, which then casts no shadow outside
+	Point<T> firstTangent;    // tangent points of the lines from the light to the circle
+	Point<T> secondTangent;
+	HalfPlane<T> firstSide;   // sides of the tangent lines containing the circle
+	HalfPlane<T> secondSide;
+	HalfPlane<T> back;        // side of the chord opposite to the light
+
+	// Returns true if the point (out of the circle) is in the shadow of the circle.
+	// The points of the circle itself on the side of the light are in front of the chord, hence lit:
+	// this is wanted, the former test put them in the shadow of their own circle.
+	bool contains(const Point<T> &p) const {
+		return !lightInside && firstSide(p) > 0 && secondSide(p) > 0 && back(p) > 0;
+	}
+
+	// Returns true if the line through the light and the point crosses the circle
+	bool isCrossedByLineFrom(const Point<T> &p) const {
+		return lightInside || ((firstSide(p) > 0) == (secondSide(p) > 0));
+	}
+};
+
+// Get the shadow wedge of the circle c of known center (see Scene) lit from the point light.
+// The tangent points are the intersection of c with the circle of diameter [light, center].
+template<typename T>
+ShadowWedge<T> shadowWedge(const Point<T> &light, const Circle<T> &c, const Point<T> &center) {
+	ShadowWedge<T> wedge;
+	if (isPointInCircle(light, c)) {
+		wedge.lightInside = true;
+		return wedge;
+	}
+	const Circle<T> thales(T(.5) * (light[1] + center[1]), T(.5) * (light[2] + center[2]), T(.5) * sqrt(squaredDistance(light, center)));
+	const PointPair<T> tangents = getIntersection(c, thales);
+	if (!isRealPointPair(tangents)) {
+		// The light is on the circle: the shadow is the side of the tangent at the light containing the circle
+		const Point<T> onTangent(light[1] + light[2] - center[2], light[2] - light[1] + center[1]);
+		wedge.firstTangent = wedge.secondTangent = light;
+		wedge.firstSide = wedge.secondSide = wedge.back = HalfPlane<T>(line(light, onTangent), center);
+		return wedge;
+	}
+	wedge.firstTangent = getFirstPointFromPointPair(tangents);
+	wedge.secondTangent = getSecondPointFromPointPair(tangents);
+	wedge.firstSide = HalfPlane<T>(line(light, wedge.firstTangent), center);
+	wedge.secondSide = HalfPlane<T>(line(light, wedge.secondTangent), center);
+	wedge.back = HalfPlane<T>(line(wedge.firstTangent, wedge.secondTangent), center); // the chord lies between the light and the center
+	return wedge;
+}
+
+// Apply a versor (see translator, rotor, dilator) to a set of circles, e.g. to animate the obstacles.
+// The sandwich product versor * c * ~versor is computed once as a 4x4 matrix.
+template<typename T>
+void applyVersor(const Mvec<T> &versor, std::vector<Circle<T>> &circles) {
+	const auto m = versorMatrix<3>(versor);
+	for (auto &c : circles) {
+		Circle<T> r;
+		for (int i = 0; i < 4; i++)
+			r[i] = m(i, 0) * c[0] + m(i, 1) * c[1] + m(i, 2) * c[2] + m(i, 3) * c[3];
+		c = r;
+	}
+}
+
 } // namespace gar
 
 #endif
@@ -36,8 +36,8 @@ template<typename T>
 void drawPointPair(const Mvec<T> &pp) {
 	if (pp.norm()*pp.norm() > 0) {
 		// 2 points
-		Mvec<T> p1 = (pp + sqrt(pp*pp)) / (-ei<T>() | pp);
-		Mvec<T> p2 = (pp - sqrt(pp*pp)) / (-ei<T>() | pp);
+		Mvec<T> p1 = (pp + sqrt(pp*pp)) / -(basis::ei | pp);
+		Mvec<T> p2 = (pp - sqrt(pp*pp)) / -(basis::ei | pp);
 		drawPoint(p1);
 		drawPoint(p2);
 	}
@@ -54,8 +54,8 @@ void drawLine(const Mvec<T> &p1, const Mvec<T> &p2) {
 template<typename T>
 void drawLine(const Mvec<T> &pp) {
 	if (pp.norm()*pp.norm() > 0) {
-		Mvec<T> p1 = (pp + sqrt(pp*pp)) / (-ei<double>()|pp);
-		Mvec<T> p2 = (pp - sqrt(pp*pp)) / (-ei<double>()|pp);
+		Mvec<T> p1 = (pp + sqrt(pp*pp)) / -(basis::ei | pp);
+		Mvec<T> p2 = (pp - sqrt(pp*pp)) / -(basis::ei | pp);
 		glBegin(GL_LINES);
 			glVertex2f(p1[E1], p1[E2]);
 			glVertex2f(p2[E1], p2[E2]);
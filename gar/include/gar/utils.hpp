@@ -9,11 +9,18 @@
 
 namespace gar {
 
-float lerp(float a, float b, float t) {
+// Scalar type of the shading (cmake -DGAR_SINGLE_PRECISION=ON for float), the pixels are shaded one at a time
+#ifdef GAR_SINGLE_PRECISION
+typedef float Real;
+#else
+typedef double Real;
+#endif
+
+inline float lerp(float a, float b, float t) {
 	return a + t * (b - a);
 }
 
-const float easeIn(const float t, const float b, const float c, const float d) {
+inline const float easeIn(const float t, const float b, const float c, const float d) {
 	return c*(t/d)*t + b;
 }
 
@@ -0,0 +1,340 @@
+/*
+ * Author : Florian TORRES
+ * Date : October 2026
+ */
+
+#include <algorithm>
+#include <thread>
+#include "gar/Renderer.hpp"
+#include "gar/c2gaTools.hpp"
+
+namespace gar {
+
+Renderer::Renderer(const int width, const int height)
+    : _width(width), _height(height), _light(350.f, 512.f, glm::vec2(0.f, 0.f)), _lightIntensity(1.f), _lightPosition(Real(0), Real(0)),
+      _bvhOutdated(false), _fixedLight(false), _visibilityMapOutdated(true), _shadows(2), _ambientIntensity(0.1f), _inObstacleColor(0.01f), _nearShadowDistance(25.f),
+      _threads(0), _tileSize(32), _progress(0)
+{
+    // Coarse to fine: each pass draws the pixels of its grid that are not on the grid of the previous pass
+    for (int step = coarsestStep; step >= 1; step /= 2) {
+        const int nbPixelsGrid = ((_height + step - 1) / step) * ((_width + step - 1) / step);
+        _passesEnds.push_back(nbPixelsGrid); // the grid of the pass is drawn at its end
+    }
+    _scene.setLight(_lightPosition);
+}
+
+void Renderer::addObstacle(const Circle<Real> &c) {
+    _scene.addObstacle(c);
+    _bvhOutdated = true;
+    _visibilityMapOutdated = true;
+    restart();
+}
+
+void Renderer::setLightPosition(const glm::vec2 &pos) {
+    _light.pos() = pos;
+    _lightPosition = Point<Real>(pos.x, pos.y);
+    _scene.setLight(_lightPosition);
+    _visibilityMapOutdated = true;
+    restart();
+}
+
+void Renderer::setLightSize(const float size) {
+    _light.size() = std::max(0.f, std::min(size, _light.maxSize()));
+    restart();
+}
+
+void Renderer::setLightIntensity(const float intensity) {
+    _lightIntensity = intensity;
+    restart();
+}
+
+void Renderer::setFixedLight(const bool fixedLight) {
+    _fixedLight = fixedLight;
+    restart();
+}
+
+void Renderer::setShadows(const int shadows) {
+    _shadows = std::max(0, std::min(shadows, 2));
+    restart();
+}
+
+void Renderer::setAmbientIntensity(const float ambientIntensity) {
+    _ambientIntensity = ambientIntensity;
+    restart();
+}
+
+void Renderer::setInObstacleColor(const float inObstacleColor) {
+    _inObstacleColor = inObstacleColor;
+    restart();
+}
+
+void Renderer::setThreads(const int threads) {
+    _threads = std::max(0, threads);
+    resetPool();
+    restart();
+}
+
+void Renderer::setTileSize(const int tileSize) {
+    _tileSize = std::max(1, tileSize);
+    restart();
+}
+
+void Renderer::restart() {
+    _progress = 0;
+}
+
+bool Renderer::render(glm::vec4 *pixels, const int nbPixels) {
+    const int nbPixelsTotal = _width * _height;
+    if (_progress == 0) {
+        std::fill(pixels, pixels + nbPixelsTotal, glm::vec4(0., 0., 0., 1.));
+        updateSearchStructures();
+    }
+
+    // One pass after the other: a pixel covers the pixels of the next passes in its block,
+    // which must not be drawn at the same time
+    const int end = std::min(_progress + nbPixels, nbPixelsTotal);
+    for (size_t pass = 0; pass < _passesEnds.size() && _progress < end; pass++) {
+        const int passEnd = std::min(_passesEnds[pass], end);
+        if (_progress >= passEnd)
+            continue;
+
+        // Tasks of 256 consecutive pixels of the pass, i.e. of a few rows
+        const int begin = _progress;
+        const int passBegin = pass == 0 ? 0 : _passesEnds[pass - 1];
+        const int step = coarsestStep >> pass;
+        const int taskSize = 256;
+        pool().run((passEnd - begin + taskSize - 1) / taskSize, [&](const unsigned int task, const unsigned int thread) {
+            const int first = begin + (int)task * taskSize;
+            const int last = std::min(first + taskSize, passEnd);
+            for (int i = first; i < last; i++) {
+                const glm::ivec2 position = pixelPosition((int)pass, i - passBegin);
+                shadePixel(position.x, position.y, step, pixels, _candidates[thread]);
+            }
+        });
+        _progress = passEnd;
+    }
+    return isComplete();
+}
+
+void Renderer::renderAll(glm::vec4 *pixels) {
+    updateSearchStructures();
+    const int nbTilesX = (_width + _tileSize - 1) / _tileSize;
+    const int nbTilesY = (_height + _tileSize - 1) / _tileSize;
+    auto bounds = [&](const unsigned int tile, int &row0, int &column0, int &row1, int &column1) {
+        row0 = (tile / nbTilesX) * _tileSize;
+        column0 = (tile % nbTilesX) * _tileSize;
+        row1 = std::min(row0 + _tileSize, _height);
+        column1 = std::min(column0 + _tileSize, _width);
+    };
+
+    // Most expensive tiles first, so that the threads end together
+    std::vector<int> priorities(nbTilesX * nbTilesY);
+    _tiles.resize(nbTilesX * nbTilesY);
+    for (unsigned int tile = 0; tile < _tiles.size(); tile++) {
+        int row0, column0, row1, column1;
+        bounds(tile, row0, column0, row1, column1);
+        priorities[tile] = tilePriority(row0, column0, row1, column1);
+        _tiles[tile] = tile;
+    }
+    std::stable_sort(_tiles.begin(), _tiles.end(), [&](const unsigned int a, const unsigned int b) { return priorities[a] < priorities[b]; });
+
+    pool().run((unsigned int)_tiles.size(), [&](const unsigned int task, const unsigned int thread) {
+        int row0, column0, row1, column1;
+        bounds(_tiles[task], row0, column0, row1, column1);
+        for (int row = row0; row < row1; row++)
+            for (int column = column0; column < column1; column++)
+                shadePixel(row, column, 1, pixels, _candidates[thread]);
+    });
+    _progress = _width * _height;
+}
+
+void Renderer::shadePixel(const int row, const int column, const int size, glm::vec4 *pixels, std::vector<unsigned int> &candidates) const {
+    // Get the point from the coords of the pixel, the origin being at the center of the image
+    const Point<Real> pixel((Real)column - _width * Real(.5), -(Real)row + _height * Real(.5));
+    const float intensity = _lightIntensity * shade(pixel, candidates);
+    const glm::vec4 color(intensity, intensity, intensity, 1.); // RGBA
+    const int rowEnd = std::min(row + size, _height);
+    const int columnEnd = std::min(column + size, _width);
+    for (int i = row; i < rowEnd; i++)
+        std::fill(pixels + i * _width + column, pixels + i * _width + columnEnd, color);
+}
+
+glm::ivec2 Renderer::pixelPosition(const int pass, const int k) const {
+    const int step = coarsestStep >> pass;
+    const int nbColumns = (_width + step - 1) / step; // of the grid of the pass
+    if (pass == 0)
+        return glm::ivec2((k / nbColumns) * step, (k % nbColumns) * step);
+
+    // The rows of the grid go by pairs: a row of the previous grid, of which the pass draws the
+    // odd columns, then a new row, drawn entirely
+    const int nbOddColumns = nbColumns / 2;
+    const int pair = k / (nbOddColumns + nbColumns);
+    const int i = k % (nbOddColumns + nbColumns);
+    if (i < nbOddColumns)
+        return glm::ivec2(2 * pair * step, (2 * i + 1) * step);
+    return glm::ivec2((2 * pair + 1) * step, (i - nbOddColumns) * step);
+}
+
+unsigned int Renderer::nbThreads() const {
+    if (_threads > 0)
+        return _threads;
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+TaskPool& Renderer::pool() {
+    if (!_pool)
+        resetPool();
+    return *_pool;
+}
+
+void Renderer::resetPool() {
+    _pool.reset(); // stop the former threads first
+    _pool.reset(new TaskPool(nbThreads()));
+    _candidates.resize(_pool->size());
+}
+
+int Renderer::tilePriority(const int row0, const int column0, const int row1, const int column1) const {
+    // Bounds of the tile in the scene
+    const glm::vec2 lower(column0 - _width * .5f, -(row1 - 1) + _height * .5f);
+    const glm::vec2 upper((column1 - 1) - _width * .5f, -row0 + _height * .5f);
+    if (glm::distance(glm::clamp(_light.pos(), lower, upper), _light.pos()) > _light.size())
+        return 2; // Only the ambient light
+
+    // Obstacle near the tile
+    bool isBoundary = false;
+    const glm::vec2 margin(_nearShadowDistance);
+    _bvh.forEachObstacleIn(glimac::BBox2f(lower - margin, upper + margin), [&](const unsigned int) {
+        isBoundary = true;
+        return false;
+    });
+
+    // Corners of the tile partly in the shadow
+    if (!isBoundary && _shadows > 0) {
+        const bool corner = isInShadow(Point<Real>(lower.x, lower.y));
+        isBoundary = isInShadow(Point<Real>(upper.x, lower.y)) != corner
+                  || isInShadow(Point<Real>(lower.x, upper.y)) != corner
+                  || isInShadow(Point<Real>(upper.x, upper.y)) != corner;
+    }
+    return isBoundary ? 0 : 1;
+}
+
+bool Renderer::isInShadow(const Point<Real> &p) const {
+    bool isShadowed = false;
+    _bvh.forEachObstacleAlong(p, _lightPosition, [&](const unsigned int o) {
+        isShadowed = _scene.shadowWedge(o).contains(p);
+        return !isShadowed;
+    });
+    return isShadowed;
+}
+
+void Renderer::updateSearchStructures() {
+    if (_bvhOutdated) {
+        _bvh.build(_scene);
+        _bvhOutdated = false;
+    }
+    if (_fixedLight && _visibilityMapOutdated) {
+        _visibilityMap.build(_scene);
+        _visibilityMapOutdated = false;
+    }
+}
+
+float Renderer::shade(const Point<Real> &pixel, std::vector<unsigned int> &candidates) const {
+    // Get the distance between the pixel and the light source
+    const float distanceFromLight = distance(_lightPosition, pixel);
+    if (distanceFromLight > _light.size()) {
+        // The pixel is too far from the light source
+        return _ambientIntensity; // We show the ambient light
+    }
+
+    bool isIntersected = false;
+    bool isInCircle = false;
+    bool closeToCircle = false;
+    float lessDistanceFromBackPoint = 0.f;
+    const auto lineToLight = line(pixel, _lightPosition);
+
+    // Obstacles that may contain the pixel or, for the advanced shadows, have their back point
+    // close to it, i.e. are crossed by the line to the light and near the pixel, in index order
+    candidates.clear();
+    const size_t interval = _fixedLight ? _visibilityMap.interval(pixel) : 0;
+    if (_fixedLight) {
+        // The obstacles crossed by the line are the ones of the intervals of the map on both sides of the light
+        const Real searchSize = _shadows == 2 ? _nearShadowDistance : Real(0);
+        _visibilityMap.forEachObstacle(interval, _visibilityMap.oppositeInterval(pixel), [&](const unsigned int o) {
+            if (pixel[1] >= _scene.minX(o) - searchSize && pixel[1] <= _scene.maxX(o) + searchSize
+             && pixel[2] >= _scene.minY(o) - searchSize && pixel[2] <= _scene.maxY(o) + searchSize
+             && _scene.shadowWedge(o).isCrossedByLineFrom(pixel))
+                candidates.push_back(o);
+            return true;
+        });
+    } else {
+        const glm::vec2 pixelPosition((float)pixel[1], (float)pixel[2]);
+        const glm::vec2 searchSize(_shadows == 2 ? _nearShadowDistance : 0.f);
+        _bvh.forEachObstacleIn(glimac::BBox2f(pixelPosition - searchSize, pixelPosition + searchSize), [&](const unsigned int o) {
+            if (_scene.shadowWedge(o).isCrossedByLineFrom(pixel))
+                candidates.push_back(o);
+            return true;
+        });
+        std::sort(candidates.begin(), candidates.end());
+    }
+
+    for (const auto o : candidates) {
+        const auto &obstacle = _scene.obstacle(o);
+
+        if (isPointInCircle(pixel, obstacle)) {
+            isIntersected = true;
+            isInCircle = true;
+            break;
+        }
+
+        if (_shadows > 0) {
+            // BASIC SHADOWS
+            // Detect if the pixel is in shadow of an obstacle
+            if (_scene.shadowWedge(o).contains(pixel))
+                isIntersected = true;
+
+            // ADVANCED SHADOWS
+            if (_shadows == 2) {
+                const auto interBetweenLightAndObstacle = intersectLineCircle(lineToLight, obstacle);
+                if (interBetweenLightAndObstacle.intersected) {
+                    // Detect if the pixel is in the shadow near the obstacle
+                    const float distanceFromBackPoint = distance(interBetweenLightAndObstacle.second, pixel);
+                    if (distanceFromBackPoint < _nearShadowDistance) {
+                        closeToCircle = true;
+                        lessDistanceFromBackPoint = distanceFromBackPoint;
+                    }
+                }
+            }
+        }
+    }
+
+    // BASIC SHADOWS of the other obstacles: only the ones met by the segment to the light can shadow the pixel
+    if (_shadows > 0 && !isIntersected) {
+        if (!_fixedLight) {
+            isIntersected = isInShadow(pixel);
+        } else if (distanceFromLight >= _visibilityMap.near(interval)) {
+            // The obstacles of the interval of the pixel, unless the pixel is nearer to the light than all of them
+            for (auto o = _visibilityMap.begin(interval); o != _visibilityMap.end(interval) && !isIntersected; o++)
+                isIntersected = _scene.shadowWedge(*o).contains(pixel);
+        }
+    }
+
+    float intensity = easeIn(1.f - (distanceFromLight / _light.size()), _ambientIntensity, 1.f, 1.5f);
+
+    if (isIntersected) {
+        if (isInCircle) {
+            // The pixel is in a circle
+            intensity = easeIn(1.f - (distanceFromLight / _light.size()), _inObstacleColor, _ambientIntensity, 1.f);
+            intensity = lerp(_ambientIntensity, intensity, 1.f - (distanceFromLight / _light.size()));
+        } else {
+            // The pixel is not is behind a circle
+            intensity = _ambientIntensity;
+            if (closeToCircle)
+                intensity = lerp(_ambientIntensity * .7f, _ambientIntensity, lessDistanceFromBackPoint / _nearShadowDistance);
+        }
+    } else if (closeToCircle) {
+        intensity = easeIn(1.f - lessDistanceFromBackPoint / 30.f, intensity, 1.f, 1.f);
+    }
+    return intensity;
+}
+
+} // namespace gar
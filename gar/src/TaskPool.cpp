@@ -0,0 +1,101 @@
+/*
+ * Author : Florian TORRES
+ * Date : October 2026
+ */
+
+#include <algorithm>
+#include "gar/TaskPool.hpp"
+
+namespace gar {
+
+TaskPool::TaskPool(const unsigned int nbThreads)
+    : _f(nullptr), _batch(0), _working(0), _stop(false)
+{
+    const unsigned int n = std::max(1u, nbThreads);
+    for (unsigned int i = 0; i < n; i++)
+        _queues.emplace_back(new Queue);
+    // Thread 0 is the one calling run
+    for (unsigned int i = 1; i < n; i++)
+        _threads.emplace_back(&TaskPool::wait, this, i);
+}
+
+TaskPool::~TaskPool() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _started.notify_all();
+    for (auto &thread : _threads)
+        thread.join();
+}
+
+void TaskPool::run(const unsigned int nbTasks, const std::function<void(unsigned int, unsigned int)> &f) {
+    // Deal the tasks in turn, so that each queue starts with the first ones
+    for (unsigned int task = 0; task < nbTasks; task++)
+        _queues[task % _queues.size()]->tasks.push_back(task);
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _f = &f;
+        _working = (unsigned int)_threads.size();
+        _batch++;
+    }
+    _started.notify_all();
+
+    work(0);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _finished.wait(lock, [this] { return _working == 0; });
+    _f = nullptr;
+}
+
+void TaskPool::wait(const unsigned int thread) {
+    unsigned int batch = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _started.wait(lock, [&] { return _stop || _batch != batch; });
+            if (_stop)
+                return;
+            batch = _batch;
+        }
+        work(thread);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _working--;
+        }
+        _finished.notify_one();
+    }
+}
+
+void TaskPool::work(const unsigned int thread) {
+    unsigned int task;
+    while (pop(thread, task) || steal(thread, task))
+        (*_f)(task, thread);
+}
+
+bool TaskPool::pop(const unsigned int thread, unsigned int &task) {
+    Queue &queue = *_queues[thread];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty())
+        return false;
+    task = queue.tasks.front();
+    queue.tasks.pop_front();
+    return true;
+}
+
+bool TaskPool::steal(const unsigned int thread, unsigned int &task) {
+    // Take from the back, away from the owner of the queue
+    for (unsigned int i = 1; i < _queues.size(); i++) {
+        Queue &queue = *_queues[(thread + i) % _queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty())
+            continue;
+        task = queue.tasks.back();
+        queue.tasks.pop_back();
+        return true;
+    }
+    return false;
+}
+
+} // namespace gar
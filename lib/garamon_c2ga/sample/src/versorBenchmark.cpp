@@ -0,0 +1,95 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <c2ga/Mvec.hpp>
+#include <c2ga/MvecBatch.hpp>
+#include <c2ga/Versor.hpp>
+
+using namespace c2ga;
+
+// Benchmark of the application of a versor (here a translator times a rotor) to a set of circles:
+//  - generic : V * X * ~V with two geometric products per circle
+//  - matrix  : VersorTransform, the 4x4 matrix of the sandwich (see versorMatrix) applied to each circle
+//  - batch   : VersorTransform on MvecBatch, the matrix applied to blocks of circles
+
+const int nbCircles = 1 << 14;
+const int nbRepeats = 20;
+const int batchSize = 64;
+
+// circle of center (x,y) and radius r, i.e. the dual of the point x e1 + y e2 + 0.5(x^2+y^2-r^2) ei + e0
+Mvec<double> circle(const double x, const double y, const double r) {
+    Mvec<double> dualCircle;
+    dualCircle[E0] = 1.0;
+    dualCircle[E1] = x;
+    dualCircle[E2] = y;
+    dualCircle[Ei] = 0.5 * (x*x + y*y - r*r);
+    return !dualCircle;
+}
+
+template<typename F>
+double circlesPerSecond(F transform) {
+    auto start = std::chrono::steady_clock::now();
+    for(int k=0; k<nbRepeats; ++k)
+        transform();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return double(nbCircles) * nbRepeats / elapsed.count();
+}
+
+int main(){
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> uniform(-200.0, 200.0);
+    std::vector<Mvec<double>> circles(nbCircles);
+    for(auto &c : circles)
+        c = circle(uniform(rng), uniform(rng), 10.0 + std::abs(uniform(rng)) * 0.25);
+
+    // versor: translation by (3,-1) after a rotation of 0.1 radian around the origin
+    const double angle = 0.1;
+    Mvec<double> rotor = cos(0.5*angle) - sin(0.5*angle) * e12<double>();
+    Mvec<double> translator = 1.0 - 0.5 * ((3.0 * e1<double>() - 1.0 * e2<double>()) * ei<double>());
+    Mvec<double> versor = translator * rotor;
+
+    // generic sandwich product
+    std::vector<Mvec<double>> generic(nbCircles);
+    double genericRate = circlesPerSecond([&](){
+        const Mvec<double> reverse = ~versor;
+        for(int i=0; i<nbCircles; ++i)
+            generic[i] = versor * circles[i] * reverse;
+    });
+
+    // matrix of the sandwich product, one matrix-vector product per circle
+    std::vector<Mvec<double>> matrix(nbCircles);
+    double matrixRate = circlesPerSecond([&](){
+        const VersorTransform<double> transform(versor);
+        for(int i=0; i<nbCircles; ++i)
+            matrix[i] = transform(circles[i]);
+    });
+
+    // batches of circles
+    std::vector<MvecBatch<double,batchSize>, Eigen::aligned_allocator<MvecBatch<double,batchSize>>> batches(nbCircles / batchSize), results(nbCircles / batchSize);
+    for(int i=0; i<nbCircles; ++i)
+        batches[i / batchSize].set(i % batchSize, circles[i]);
+    double batchRate = circlesPerSecond([&](){
+        const VersorTransform<double> transform(versor);
+        for(unsigned int b=0; b<batches.size(); ++b)
+            results[b] = transform(batches[b]);
+    });
+
+    // check
+    double error = 0;
+    for(int i=0; i<nbCircles; ++i)
+        for(unsigned int j=0; j<4; ++j){
+            const double reference = generic[i].findGrade(3)->vec.coeff(j);
+            error = std::max(error, std::abs(matrix[i].findGrade(3)->vec.coeff(j) - reference));
+            error = std::max(error, std::abs(results[i / batchSize].kvec<3>()(i % batchSize, j) - reference));
+        }
+
+    std::cout << "circles transformed per second" << std::endl;
+    std::cout << "  generic V*X*~V              : " << genericRate << std::endl;
+    std::cout << "  VersorTransform on Mvec     : " << matrixRate << std::endl;
+    std::cout << "  VersorTransform on MvecBatch: " << batchRate << " (batches of " << batchSize << ")" << std::endl;
+    std::cout << "max error : " << error << std::endl;
+
+    return 0;
+}
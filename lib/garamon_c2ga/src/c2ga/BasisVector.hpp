@@ -0,0 +1,184 @@
+// Copyright (c) 2018 by University Paris-Est Marne-la-Vallee
+// BasisVector.hpp
+// This file is part of the Garamon for c2ga.
+// Authors: Stephane Breuils and Vincent Nozick
+// Contact: vincent.nozick@u-pem.fr
+//
+// Licence MIT
+// A a copy of the MIT License is given along with this program
+
+/// \file BasisVector.hpp
+/// \author Stephane Breuils, Vincent Nozick
+/// \brief Products between a multivector and a basis vector known at compile time (e.g. mv ^ basis::ei): each component of the multivector is moved, with a sign, to at most one component of the result, so these products are precomputed permutations instead of generic products.
+
+
+#ifndef C2GA_BASIS_VECTOR_HPP__
+#define C2GA_BASIS_VECTOR_HPP__
+#pragma once
+
+#include "c2ga/Mvec.hpp"
+
+
+/*!
+ * @namespace c2ga
+ */
+namespace c2ga {
+
+	/// \class BasisVector
+	/// \brief tag type of the unit basis vector e0, e1, e2 or ei, i.e. the component "index" of the grade 1 part of a multivector. Unlike e0<T>() ... ei<T>(), it holds no data: the products with a BasisVector are resolved at compile time.
+	template<unsigned int index>
+	struct BasisVector {
+		static_assert(index < algebraDimension, "a basis vector index is lower than the dimension of the algebra");
+
+		/// \brief the basis vector as a multivector
+		template<typename T>
+		Mvec<T> mvec() const {
+			Mvec<T> mv;
+			mv.at(1, index) = T(1);
+			return mv;
+		}
+	};
+
+	/*!
+	 * @namespace basis
+	 */
+	namespace basis {
+		constexpr BasisVector<0> e0{}; /*!< tag of the basis vector e0 */
+		constexpr BasisVector<1> e1{}; /*!< tag of the basis vector e1 */
+		constexpr BasisVector<2> e2{}; /*!< tag of the basis vector e2 */
+		constexpr BasisVector<3> ei{}; /*!< tag of the basis vector ei */
+	}
+
+	/// \brief mv ^ e_k: target index (plus one, signed) in the grade g+1 part for each component of the grade g part of mv, 0 when the component vanishes
+	constexpr int outerBasisVectorRight[4][5][6] = {
+		{{1},{0,-1,-2,-3},{0,0,0,1,2,3},{0,0,0,-1},{0}},
+		{{2},{1,0,-4,-5},{0,-1,-2,0,0,4},{0,0,1,0},{0}},
+		{{3},{2,4,0,-6},{1,0,-3,0,-4,0},{0,-1,0,0},{0}},
+		{{4},{3,5,6,0},{2,3,0,4,0,0},{1,0,0,0},{0}}
+	};
+
+	/// \brief e_k ^ mv, same layout as outerBasisVectorRight
+	constexpr int outerBasisVectorLeft[4][5][6] = {
+		{{1},{0,1,2,3},{0,0,0,1,2,3},{0,0,0,1},{0}},
+		{{2},{-1,0,4,5},{0,-1,-2,0,0,4},{0,0,-1,0},{0}},
+		{{3},{-2,-4,0,6},{1,0,-3,0,-4,0},{0,1,0,0},{0}},
+		{{4},{-3,-5,-6,0},{2,3,0,4,0,0},{-1,0,0,0},{0}}
+	};
+
+	/// \brief mv | e_k: target index (plus one, signed) in the grade |g-1| part for each component of the grade g part of mv, 0 when the component vanishes
+	constexpr int innerBasisVectorRight[4][5][6] = {
+		{{1},{0,0,0,-1},{0,0,-1,0,-2,-3},{0,-1,-2,-4},{-1}},
+		{{2},{0,1,0,0},{1,0,0,-3,-4,0},{-2,-3,0,6},{3}},
+		{{3},{0,0,1,0},{0,1,0,2,0,-4},{1,0,-3,-5},{-2}},
+		{{4},{-1,0,0,0},{2,3,4,0,0,0},{-4,-5,-6,0},{4}}
+	};
+
+	/// \brief e_k | mv, same layout as innerBasisVectorRight
+	constexpr int innerBasisVectorLeft[4][5][6] = {
+		{{1},{0,0,0,-1},{0,0,1,0,2,3},{0,-1,-2,-4},{1}},
+		{{2},{0,1,0,0},{-1,0,0,3,4,0},{-2,-3,0,6},{-3}},
+		{{3},{0,0,1,0},{0,-1,0,-2,0,4},{1,0,-3,-5},{2}},
+		{{4},{-1,0,0,0},{-2,-3,-4,0,0,0},{-4,-5,-6,0},{-4}}
+	};
+
+	/// \brief mv > e_k, same layout as innerBasisVectorRight
+	constexpr int rightContractionBasisVector[4][5][6] = {
+		{{0},{0,0,0,-1},{0,0,-1,0,-2,-3},{0,-1,-2,-4},{-1}},
+		{{0},{0,1,0,0},{1,0,0,-3,-4,0},{-2,-3,0,6},{3}},
+		{{0},{0,0,1,0},{0,1,0,2,0,-4},{1,0,-3,-5},{-2}},
+		{{0},{-1,0,0,0},{2,3,4,0,0,0},{-4,-5,-6,0},{4}}
+	};
+
+	/// \brief e_k < mv, same layout as innerBasisVectorRight
+	constexpr int leftContractionBasisVector[4][5][6] = {
+		{{0},{0,0,0,-1},{0,0,1,0,2,3},{0,-1,-2,-4},{1}},
+		{{0},{0,1,0,0},{-1,0,0,3,4,0},{-2,-3,0,6},{-3}},
+		{{0},{0,0,1,0},{0,-1,0,-2,0,4},{1,0,-3,-5},{2}},
+		{{0},{-1,0,0,0},{-2,-3,-4,0,0,0},{-4,-5,-6,0},{-4}}
+	};
+
+
+	/// \cond DEV
+	/// \brief move, with their sign, the components of the grade "grade" k-vector vec to vec3 following a product table
+	template<const int (&table)[4][5][6], unsigned int index, unsigned int grade, typename T>
+	inline void basisVectorMove(const KvecStorage<T>& vec, KvecStorage<T>& vec3){
+		for(unsigned int i=0; i<Binomial<algebraDimension,grade>::value; ++i){
+			const int target = table[index][grade][i];
+			if(target > 0)
+				vec3.coeffRef(target-1) += vec.coeff(i);
+			else if(target < 0)
+				vec3.coeffRef(-target-1) -= vec.coeff(i);
+		}
+	}
+
+	/// \brief apply a product table to each k-vector of mv. The null k-vectors of the result are removed.
+	/// \tparam table - one of the product tables above
+	/// \tparam index - index of the basis vector
+	/// \tparam outer - true for an outer product (grade g -> g+1), false for the inner products (grade g -> |g-1|)
+	/// \param mv - the multivector
+	/// \return the product of mv with the basis vector
+	template<const int (&table)[4][5][6], unsigned int index, bool outer, typename T>
+	inline Mvec<T> basisVectorProduct(const Mvec<T>& mv){
+		Mvec<T> mv3;
+		for(const auto & itMv : mv.mvData){
+			const unsigned int gradeMv3 = outer ? itMv.grade+1 : (itMv.grade ? itMv.grade-1 : 1);
+			if(gradeMv3 > algebraDimension)
+				continue;
+			auto itMv3 = mv3.createVectorXdIfDoesNotExist(gradeMv3);
+			switch(itMv.grade){
+				case 0: basisVectorMove<table,index,0>(itMv.vec, itMv3->vec); break;
+				case 1: basisVectorMove<table,index,1>(itMv.vec, itMv3->vec); break;
+				case 2: basisVectorMove<table,index,2>(itMv.vec, itMv3->vec); break;
+				case 3: basisVectorMove<table,index,3>(itMv.vec, itMv3->vec); break;
+				case 4: basisVectorMove<table,index,4>(itMv.vec, itMv3->vec); break;
+			}
+		}
+		for(auto itMv3 = mv3.mvData.begin(); itMv3 != mv3.mvData.end(); )
+			if(!((itMv3->vec.array() != 0.0).any())){
+				mv3.gradeBitmap &= ~(1<<itMv3->grade);
+				itMv3 = mv3.mvData.erase(itMv3);
+			}
+			else ++itMv3;
+		return mv3;
+	}
+	/// \endcond
+
+	/// \brief outer product between a multivector and a basis vector, mv ^ e_k
+	template<typename T, unsigned int index>
+	inline Mvec<T> operator^(const Mvec<T>& mv, BasisVector<index>){
+		return basisVectorProduct<outerBasisVectorRight, index, true>(mv);
+	}
+
+	/// \brief outer product between a basis vector and a multivector, e_k ^ mv
+	template<typename T, unsigned int index>
+	inline Mvec<T> operator^(BasisVector<index>, const Mvec<T>& mv){
+		return basisVectorProduct<outerBasisVectorLeft, index, true>(mv);
+	}
+
+	/// \brief inner product between a multivector and a basis vector, mv | e_k
+	template<typename T, unsigned int index>
+	inline Mvec<T> operator|(const Mvec<T>& mv, BasisVector<index>){
+		return basisVectorProduct<innerBasisVectorRight, index, false>(mv);
+	}
+
+	/// \brief inner product between a basis vector and a multivector, e_k | mv
+	template<typename T, unsigned int index>
+	inline Mvec<T> operator|(BasisVector<index>, const Mvec<T>& mv){
+		return basisVectorProduct<innerBasisVectorLeft, index, false>(mv);
+	}
+
+	/// \brief right contraction of a multivector by a basis vector, mv > e_k
+	template<typename T, unsigned int index>
+	inline Mvec<T> operator>(const Mvec<T>& mv, BasisVector<index>){
+		return basisVectorProduct<rightContractionBasisVector, index, false>(mv);
+	}
+
+	/// \brief left contraction of a multivector by a basis vector, e_k < mv
+	template<typename T, unsigned int index>
+	inline Mvec<T> operator<(BasisVector<index>, const Mvec<T>& mv){
+		return basisVectorProduct<leftContractionBasisVector, index, false>(mv);
+	}
+
+}/// End of Namespace
+
+#endif // C2GA_BASIS_VECTOR_HPP__
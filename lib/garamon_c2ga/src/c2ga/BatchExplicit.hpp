@@ -0,0 +1,516 @@
+// Copyright (c) 2018 by University Paris-Est Marne-la-Vallee
+// BatchExplicit.hpp
+// This file is part of the Garamon for c2ga.
+// Authors: Stephane Breuils and Vincent Nozick
+// Contact: vincent.nozick@u-pem.fr
+//
+// Licence MIT
+// A a copy of the MIT License is given along with this program
+
+/// \file BatchExplicit.hpp
+/// \author Stephane Breuils, Vincent Nozick
+/// \brief Explicit precomputed per grades products of c2ga, applied to N multivectors at once (structure of arrays). These are the kernels of OuterExplicit.hpp, InnerExplicit.hpp and GeometricExplicit.hpp where each coefficient is replaced by the array of this coefficient over the batch, so that Eigen vectorizes them.
+
+
+#ifndef C2GA_BATCH_EXPLICIT_HPP__
+#define C2GA_BATCH_EXPLICIT_HPP__
+#pragma once
+
+#include <tuple>
+#include <Eigen/Core>
+
+#include "c2ga/Constants.hpp"
+
+
+/*!
+ * @namespace c2ga
+ */
+namespace c2ga {
+
+    /// \brief storage of the grade "grade" part of N multivectors: one column per basis blade, each column is the contiguous array of the coefficients of this blade over the N multivectors.
+    template<typename T, int N, unsigned int grade>
+    using KvecBatch = Eigen::Array<T, N, (int)binomialArray[grade], Eigen::ColMajor>;
+
+    /// \brief storage of all the grades of N multivectors.
+    template<typename T, int N>
+    using KvecBatchTuple = std::tuple<KvecBatch<T,N,0>, KvecBatch<T,N,1>, KvecBatch<T,N,2>, KvecBatch<T,N,3>, KvecBatch<T,N,4>>;
+
+
+	/// \brief Batched version of outer_0_0: accumulate the grade 0 part of mv1^mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void outerBatch_0_0(const KvecBatch<T,N,0>& mv1, const KvecBatch<T,N,0>& mv2, KvecBatch<T,N,0>& mv3){
+		mv3.col(0) +=  mv1.col(0)*mv2.col(0);
+	}
+
+
+	/// \brief Batched version of outer_0_1: accumulate the grade 1 part of mv1^mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void outerBatch_0_1(const KvecBatch<T,N,0>& mv1, const KvecBatch<T,N,1>& mv2, KvecBatch<T,N,1>& mv3){
+		mv3 += mv2.colwise() * mv1.col(0);
+	}
+
+
+	/// \brief Batched version of outer_0_2: accumulate the grade 2 part of mv1^mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void outerBatch_0_2(const KvecBatch<T,N,0>& mv1, const KvecBatch<T,N,2>& mv2, KvecBatch<T,N,2>& mv3){
+		mv3 += mv2.colwise() * mv1.col(0);
+	}
+
+
+	/// \brief Batched version of outer_0_3: accumulate the grade 3 part of mv1^mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void outerBatch_0_3(const KvecBatch<T,N,0>& mv1, const KvecBatch<T,N,3>& mv2, KvecBatch<T,N,3>& mv3){
+		mv3 += mv2.colwise() * mv1.col(0);
+	}
+
+
+	/// \brief Batched version of outer_0_4: accumulate the grade 4 part of mv1^mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void outerBatch_0_4(const KvecBatch<T,N,0>& mv1, const KvecBatch<T,N,4>& mv2, KvecBatch<T,N,4>& mv3){
+		mv3 += mv2.colwise() * mv1.col(0);
+	}
+
+
+	/// \brief Batched version of outer_1_0: accumulate the grade 1 part of mv1^mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void outerBatch_1_0(const KvecBatch<T,N,1>& mv1, const KvecBatch<T,N,0>& mv2, KvecBatch<T,N,1>& mv3){
+		mv3 += mv1.colwise() * mv2.col(0);
+	}
+
+
+	/// \brief Batched version of outer_1_1: accumulate the grade 2 part of mv1^mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void outerBatch_1_1(const KvecBatch<T,N,1>& mv1, const KvecBatch<T,N,1>& mv2, KvecBatch<T,N,2>& mv3){
+		mv3.col(0) +=  mv1.col(0)*mv2.col(1) - mv1.col(1)*mv2.col(0);
+		mv3.col(1) +=  mv1.col(0)*mv2.col(2) - mv1.col(2)*mv2.col(0);
+		mv3.col(2) +=  mv1.col(0)*mv2.col(3) - mv1.col(3)*mv2.col(0);
+		mv3.col(3) +=  mv1.col(1)*mv2.col(2) - mv1.col(2)*mv2.col(1);
+		mv3.col(4) +=  mv1.col(1)*mv2.col(3) - mv1.col(3)*mv2.col(1);
+		mv3.col(5) +=  mv1.col(2)*mv2.col(3) - mv1.col(3)*mv2.col(2);
+	}
+
+
+	/// \brief Batched version of outer_1_2: accumulate the grade 3 part of mv1^mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void outerBatch_1_2(const KvecBatch<T,N,1>& mv1, const KvecBatch<T,N,2>& mv2, KvecBatch<T,N,3>& mv3){
+		mv3.col(0) +=  mv1.col(0)*mv2.col(3) - mv1.col(1)*mv2.col(1) + mv1.col(2)*mv2.col(0);
+		mv3.col(1) +=  mv1.col(0)*mv2.col(4) - mv1.col(1)*mv2.col(2) + mv1.col(3)*mv2.col(0);
+		mv3.col(2) +=  mv1.col(0)*mv2.col(5) - mv1.col(2)*mv2.col(2) + mv1.col(3)*mv2.col(1);
+		mv3.col(3) +=  mv1.col(1)*mv2.col(5) - mv1.col(2)*mv2.col(4) + mv1.col(3)*mv2.col(3);
+	}
+
+
+	/// \brief Batched version of outer_1_3: accumulate the grade 4 part of mv1^mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void outerBatch_1_3(const KvecBatch<T,N,1>& mv1, const KvecBatch<T,N,3>& mv2, KvecBatch<T,N,4>& mv3){
+		mv3.col(0) +=  mv1.col(0)*mv2.col(3) - mv1.col(1)*mv2.col(2) + mv1.col(2)*mv2.col(1) - mv1.col(3)*mv2.col(0);
+	}
+
+
+	/// \brief Batched version of outer_2_0: accumulate the grade 2 part of mv1^mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void outerBatch_2_0(const KvecBatch<T,N,2>& mv1, const KvecBatch<T,N,0>& mv2, KvecBatch<T,N,2>& mv3){
+		mv3 += mv1.colwise() * mv2.col(0);
+	}
+
+
+	/// \brief Batched version of outer_2_1: accumulate the grade 3 part of mv1^mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void outerBatch_2_1(const KvecBatch<T,N,2>& mv1, const KvecBatch<T,N,1>& mv2, KvecBatch<T,N,3>& mv3){
+		mv3.col(0) +=  mv1.col(0)*mv2.col(2) - mv1.col(1)*mv2.col(1) + mv1.col(3)*mv2.col(0);
+		mv3.col(1) +=  mv1.col(0)*mv2.col(3) - mv1.col(2)*mv2.col(1) + mv1.col(4)*mv2.col(0);
+		mv3.col(2) +=  mv1.col(1)*mv2.col(3) - mv1.col(2)*mv2.col(2) + mv1.col(5)*mv2.col(0);
+		mv3.col(3) +=  mv1.col(3)*mv2.col(3) - mv1.col(4)*mv2.col(2) + mv1.col(5)*mv2.col(1);
+	}
+
+
+	/// \brief Batched version of outer_2_2: accumulate the grade 4 part of mv1^mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void outerBatch_2_2(const KvecBatch<T,N,2>& mv1, const KvecBatch<T,N,2>& mv2, KvecBatch<T,N,4>& mv3){
+		mv3.col(0) +=  mv1.col(0)*mv2.col(5) - mv1.col(1)*mv2.col(4) + mv1.col(2)*mv2.col(3) + mv1.col(3)*mv2.col(2) - mv1.col(4)*mv2.col(1) + mv1.col(5)*mv2.col(0);
+	}
+
+
+	/// \brief Batched version of outer_3_0: accumulate the grade 3 part of mv1^mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void outerBatch_3_0(const KvecBatch<T,N,3>& mv1, const KvecBatch<T,N,0>& mv2, KvecBatch<T,N,3>& mv3){
+		mv3 += mv1.colwise() * mv2.col(0);
+	}
+
+
+	/// \brief Batched version of outer_3_1: accumulate the grade 4 part of mv1^mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void outerBatch_3_1(const KvecBatch<T,N,3>& mv1, const KvecBatch<T,N,1>& mv2, KvecBatch<T,N,4>& mv3){
+		mv3.col(0) +=  mv1.col(0)*mv2.col(3) - mv1.col(1)*mv2.col(2) + mv1.col(2)*mv2.col(1) - mv1.col(3)*mv2.col(0);
+	}
+
+
+	/// \brief Batched version of outer_4_0: accumulate the grade 4 part of mv1^mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void outerBatch_4_0(const KvecBatch<T,N,4>& mv1, const KvecBatch<T,N,0>& mv2, KvecBatch<T,N,4>& mv3){
+		mv3 += mv1.colwise() * mv2.col(0);
+	}
+
+
+	/// \brief Batched version of inner_0_0: accumulate the grade 0 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_0_0(const KvecBatch<T,N,0>& mv1, const KvecBatch<T,N,0>& mv2, KvecBatch<T,N,0>& mv3){
+		mv3.col(0) +=  mv1.col(0)*mv2.col(0);
+	}
+
+
+	/// \brief Batched version of inner_0_1: accumulate the grade 1 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_0_1(const KvecBatch<T,N,0>& mv1, const KvecBatch<T,N,1>& mv2, KvecBatch<T,N,1>& mv3){
+		mv3 += mv2.colwise() * mv1.col(0);
+	}
+
+
+	/// \brief Batched version of inner_0_2: accumulate the grade 2 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_0_2(const KvecBatch<T,N,0>& mv1, const KvecBatch<T,N,2>& mv2, KvecBatch<T,N,2>& mv3){
+		mv3 += mv2.colwise() * mv1.col(0);
+	}
+
+
+	/// \brief Batched version of inner_0_3: accumulate the grade 3 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_0_3(const KvecBatch<T,N,0>& mv1, const KvecBatch<T,N,3>& mv2, KvecBatch<T,N,3>& mv3){
+		mv3 += mv2.colwise() * mv1.col(0);
+	}
+
+
+	/// \brief Batched version of inner_0_4: accumulate the grade 4 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_0_4(const KvecBatch<T,N,0>& mv1, const KvecBatch<T,N,4>& mv2, KvecBatch<T,N,4>& mv3){
+		mv3 += mv2.colwise() * mv1.col(0);
+	}
+
+
+	/// \brief Batched version of inner_1_0: accumulate the grade 1 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_1_0(const KvecBatch<T,N,1>& mv1, const KvecBatch<T,N,0>& mv2, KvecBatch<T,N,1>& mv3){
+		mv3 += mv1.colwise() * mv2.col(0);
+	}
+
+
+	/// \brief Batched version of inner_1_1: accumulate the grade 0 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_1_1(const KvecBatch<T,N,1>& mv1, const KvecBatch<T,N,1>& mv2, KvecBatch<T,N,0>& mv3){
+		mv3.col(0) += -mv1.col(0)*mv2.col(3) + mv1.col(1)*mv2.col(1) + mv1.col(2)*mv2.col(2) - mv1.col(3)*mv2.col(0);
+	}
+
+
+	/// \brief Batched version of inner_1_2: accumulate the grade 1 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_1_2(const KvecBatch<T,N,1>& mv1, const KvecBatch<T,N,2>& mv2, KvecBatch<T,N,1>& mv3){
+		mv3.col(0) +=  mv1.col(0)*mv2.col(2) - mv1.col(1)*mv2.col(0) - mv1.col(2)*mv2.col(1);
+		mv3.col(1) +=  mv1.col(0)*mv2.col(4) - mv1.col(2)*mv2.col(3) - mv1.col(3)*mv2.col(0);
+		mv3.col(2) +=  mv1.col(0)*mv2.col(5) + mv1.col(1)*mv2.col(3) - mv1.col(3)*mv2.col(1);
+		mv3.col(3) +=  mv1.col(1)*mv2.col(4) + mv1.col(2)*mv2.col(5) - mv1.col(3)*mv2.col(2);
+	}
+
+
+	/// \brief Batched version of inner_1_3: accumulate the grade 2 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_1_3(const KvecBatch<T,N,1>& mv1, const KvecBatch<T,N,3>& mv2, KvecBatch<T,N,2>& mv3){
+		mv3.col(0) += -mv1.col(0)*mv2.col(1) + mv1.col(2)*mv2.col(0);
+		mv3.col(1) += -mv1.col(0)*mv2.col(2) - mv1.col(1)*mv2.col(0);
+		mv3.col(2) += -mv1.col(1)*mv2.col(1) - mv1.col(2)*mv2.col(2);
+		mv3.col(3) += -mv1.col(0)*mv2.col(3) - mv1.col(3)*mv2.col(0);
+		mv3.col(4) += -mv1.col(2)*mv2.col(3) - mv1.col(3)*mv2.col(1);
+		mv3.col(5) +=  mv1.col(1)*mv2.col(3) - mv1.col(3)*mv2.col(2);
+	}
+
+
+	/// \brief Batched version of inner_1_4: accumulate the grade 3 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_1_4(const KvecBatch<T,N,1>& mv1, const KvecBatch<T,N,4>& mv2, KvecBatch<T,N,3>& mv3){
+		mv3.col(0) +=  mv1.col(0)*mv2.col(0);
+		mv3.col(1) +=  mv1.col(2)*mv2.col(0);
+		mv3.col(2) += -mv1.col(1)*mv2.col(0);
+		mv3.col(3) += -mv1.col(3)*mv2.col(0);
+	}
+
+
+	/// \brief Batched version of inner_2_0: accumulate the grade 2 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_2_0(const KvecBatch<T,N,2>& mv1, const KvecBatch<T,N,0>& mv2, KvecBatch<T,N,2>& mv3){
+		mv3 += mv1.colwise() * mv2.col(0);
+	}
+
+
+	/// \brief Batched version of inner_2_1: accumulate the grade 1 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_2_1(const KvecBatch<T,N,2>& mv1, const KvecBatch<T,N,1>& mv2, KvecBatch<T,N,1>& mv3){
+		mv3.col(0) +=  mv1.col(0)*mv2.col(1) + mv1.col(1)*mv2.col(2) - mv1.col(2)*mv2.col(0);
+		mv3.col(1) +=  mv1.col(0)*mv2.col(3) + mv1.col(3)*mv2.col(2) - mv1.col(4)*mv2.col(0);
+		mv3.col(2) +=  mv1.col(1)*mv2.col(3) - mv1.col(3)*mv2.col(1) - mv1.col(5)*mv2.col(0);
+		mv3.col(3) +=  mv1.col(2)*mv2.col(3) - mv1.col(4)*mv2.col(1) - mv1.col(5)*mv2.col(2);
+	}
+
+
+	/// \brief Batched version of inner_2_2: accumulate the grade 0 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_2_2(const KvecBatch<T,N,2>& mv1, const KvecBatch<T,N,2>& mv2, KvecBatch<T,N,0>& mv3){
+		mv3.col(0) += -mv1.col(0)*mv2.col(4) - mv1.col(1)*mv2.col(5) + mv1.col(2)*mv2.col(2) - mv1.col(3)*mv2.col(3) - mv1.col(4)*mv2.col(0) - mv1.col(5)*mv2.col(1);
+	}
+
+
+	/// \brief Batched version of inner_2_3: accumulate the grade 1 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_2_3(const KvecBatch<T,N,2>& mv1, const KvecBatch<T,N,3>& mv2, KvecBatch<T,N,1>& mv3){
+		mv3.col(0) += -mv1.col(0)*mv2.col(1) - mv1.col(1)*mv2.col(2) - mv1.col(3)*mv2.col(0);
+		mv3.col(1) += -mv1.col(1)*mv2.col(3) - mv1.col(2)*mv2.col(1) + mv1.col(5)*mv2.col(0);
+		mv3.col(2) +=  mv1.col(0)*mv2.col(3) - mv1.col(2)*mv2.col(2) - mv1.col(4)*mv2.col(0);
+		mv3.col(3) += -mv1.col(3)*mv2.col(3) - mv1.col(4)*mv2.col(1) - mv1.col(5)*mv2.col(2);
+	}
+
+
+	/// \brief Batched version of inner_2_4: accumulate the grade 2 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_2_4(const KvecBatch<T,N,2>& mv1, const KvecBatch<T,N,4>& mv2, KvecBatch<T,N,2>& mv3){
+		mv3.col(0) += -mv1.col(1)*mv2.col(0);
+		mv3.col(1) +=  mv1.col(0)*mv2.col(0);
+		mv3.col(2) += -mv1.col(3)*mv2.col(0);
+		mv3.col(3) +=  mv1.col(2)*mv2.col(0);
+		mv3.col(4) +=  mv1.col(5)*mv2.col(0);
+		mv3.col(5) += -mv1.col(4)*mv2.col(0);
+	}
+
+
+	/// \brief Batched version of inner_3_0: accumulate the grade 3 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_3_0(const KvecBatch<T,N,3>& mv1, const KvecBatch<T,N,0>& mv2, KvecBatch<T,N,3>& mv3){
+		mv3 += mv1.colwise() * mv2.col(0);
+	}
+
+
+	/// \brief Batched version of inner_3_1: accumulate the grade 2 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_3_1(const KvecBatch<T,N,3>& mv1, const KvecBatch<T,N,1>& mv2, KvecBatch<T,N,2>& mv3){
+		mv3.col(0) +=  mv1.col(0)*mv2.col(2) - mv1.col(1)*mv2.col(0);
+		mv3.col(1) += -mv1.col(0)*mv2.col(1) - mv1.col(2)*mv2.col(0);
+		mv3.col(2) += -mv1.col(1)*mv2.col(1) - mv1.col(2)*mv2.col(2);
+		mv3.col(3) += -mv1.col(0)*mv2.col(3) - mv1.col(3)*mv2.col(0);
+		mv3.col(4) += -mv1.col(1)*mv2.col(3) - mv1.col(3)*mv2.col(2);
+		mv3.col(5) += -mv1.col(2)*mv2.col(3) + mv1.col(3)*mv2.col(1);
+	}
+
+
+	/// \brief Batched version of inner_3_2: accumulate the grade 1 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_3_2(const KvecBatch<T,N,3>& mv1, const KvecBatch<T,N,2>& mv2, KvecBatch<T,N,1>& mv3){
+		mv3.col(0) += -mv1.col(0)*mv2.col(3) - mv1.col(1)*mv2.col(0) - mv1.col(2)*mv2.col(1);
+		mv3.col(1) +=  mv1.col(0)*mv2.col(5) - mv1.col(1)*mv2.col(2) - mv1.col(3)*mv2.col(1);
+		mv3.col(2) += -mv1.col(0)*mv2.col(4) - mv1.col(2)*mv2.col(2) + mv1.col(3)*mv2.col(0);
+		mv3.col(3) += -mv1.col(1)*mv2.col(4) - mv1.col(2)*mv2.col(5) - mv1.col(3)*mv2.col(3);
+	}
+
+
+	/// \brief Batched version of inner_3_3: accumulate the grade 0 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_3_3(const KvecBatch<T,N,3>& mv1, const KvecBatch<T,N,3>& mv2, KvecBatch<T,N,0>& mv3){
+		mv3.col(0) +=  mv1.col(0)*mv2.col(3) + mv1.col(1)*mv2.col(1) + mv1.col(2)*mv2.col(2) + mv1.col(3)*mv2.col(0);
+	}
+
+
+	/// \brief Batched version of inner_3_4: accumulate the grade 1 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_3_4(const KvecBatch<T,N,3>& mv1, const KvecBatch<T,N,4>& mv2, KvecBatch<T,N,1>& mv3){
+		mv3.col(0) += -mv1.col(0)*mv2.col(0);
+		mv3.col(1) +=  mv1.col(2)*mv2.col(0);
+		mv3.col(2) += -mv1.col(1)*mv2.col(0);
+		mv3.col(3) +=  mv1.col(3)*mv2.col(0);
+	}
+
+
+	/// \brief Batched version of inner_4_0: accumulate the grade 4 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_4_0(const KvecBatch<T,N,4>& mv1, const KvecBatch<T,N,0>& mv2, KvecBatch<T,N,4>& mv3){
+		mv3 += mv1.colwise() * mv2.col(0);
+	}
+
+
+	/// \brief Batched version of inner_4_1: accumulate the grade 3 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_4_1(const KvecBatch<T,N,4>& mv1, const KvecBatch<T,N,1>& mv2, KvecBatch<T,N,3>& mv3){
+		mv3.col(0) += -mv1.col(0)*mv2.col(0);
+		mv3.col(1) += -mv1.col(0)*mv2.col(2);
+		mv3.col(2) +=  mv1.col(0)*mv2.col(1);
+		mv3.col(3) +=  mv1.col(0)*mv2.col(3);
+	}
+
+
+	/// \brief Batched version of inner_4_2: accumulate the grade 2 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_4_2(const KvecBatch<T,N,4>& mv1, const KvecBatch<T,N,2>& mv2, KvecBatch<T,N,2>& mv3){
+		mv3.col(0) += -mv1.col(0)*mv2.col(1);
+		mv3.col(1) +=  mv1.col(0)*mv2.col(0);
+		mv3.col(2) += -mv1.col(0)*mv2.col(3);
+		mv3.col(3) +=  mv1.col(0)*mv2.col(2);
+		mv3.col(4) +=  mv1.col(0)*mv2.col(5);
+		mv3.col(5) += -mv1.col(0)*mv2.col(4);
+	}
+
+
+	/// \brief Batched version of inner_4_3: accumulate the grade 1 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_4_3(const KvecBatch<T,N,4>& mv1, const KvecBatch<T,N,3>& mv2, KvecBatch<T,N,1>& mv3){
+		mv3.col(0) +=  mv1.col(0)*mv2.col(0);
+		mv3.col(1) += -mv1.col(0)*mv2.col(2);
+		mv3.col(2) +=  mv1.col(0)*mv2.col(1);
+		mv3.col(3) += -mv1.col(0)*mv2.col(3);
+	}
+
+
+	/// \brief Batched version of inner_4_4: accumulate the grade 0 part of mv1|mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void innerBatch_4_4(const KvecBatch<T,N,4>& mv1, const KvecBatch<T,N,4>& mv2, KvecBatch<T,N,0>& mv3){
+		mv3.col(0) += -mv1.col(0)*mv2.col(0);
+	}
+
+
+	/// \brief Batched version of geometric_2_2_2: accumulate the grade 2 part of mv1 mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void geometricBatch_2_2_2(const KvecBatch<T,N,2>& mv1, const KvecBatch<T,N,2>& mv2, KvecBatch<T,N,2>& mv3){
+		mv3.col(0) +=  mv1.col(0)*mv2.col(2) - mv1.col(1)*mv2.col(3) - mv1.col(2)*mv2.col(0) + mv1.col(3)*mv2.col(1);
+		mv3.col(1) +=  mv1.col(0)*mv2.col(3) + mv1.col(1)*mv2.col(2) - mv1.col(2)*mv2.col(1) - mv1.col(3)*mv2.col(0);
+		mv3.col(2) +=  mv1.col(0)*mv2.col(4) + mv1.col(1)*mv2.col(5) - mv1.col(4)*mv2.col(0) - mv1.col(5)*mv2.col(1);
+		mv3.col(3) += -mv1.col(0)*mv2.col(5) + mv1.col(1)*mv2.col(4) - mv1.col(4)*mv2.col(1) + mv1.col(5)*mv2.col(0);
+		mv3.col(4) +=  mv1.col(2)*mv2.col(4) + mv1.col(3)*mv2.col(5) - mv1.col(4)*mv2.col(2) - mv1.col(5)*mv2.col(3);
+		mv3.col(5) +=  mv1.col(2)*mv2.col(5) - mv1.col(3)*mv2.col(4) + mv1.col(4)*mv2.col(3) - mv1.col(5)*mv2.col(2);
+	}
+
+
+	/// \brief Batched version of geometric_2_3_3: accumulate the grade 3 part of mv1 mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void geometricBatch_2_3_3(const KvecBatch<T,N,2>& mv1, const KvecBatch<T,N,3>& mv2, KvecBatch<T,N,3>& mv3){
+		mv3.col(0) += -mv1.col(0)*mv2.col(2) + mv1.col(1)*mv2.col(1) - mv1.col(2)*mv2.col(0);
+		mv3.col(1) += -mv1.col(1)*mv2.col(3) + mv1.col(3)*mv2.col(2) - mv1.col(5)*mv2.col(0);
+		mv3.col(2) +=  mv1.col(0)*mv2.col(3) - mv1.col(3)*mv2.col(1) + mv1.col(4)*mv2.col(0);
+		mv3.col(3) +=  mv1.col(2)*mv2.col(3) - mv1.col(4)*mv2.col(2) + mv1.col(5)*mv2.col(1);
+	}
+
+
+	/// \brief Batched version of geometric_3_2_3: accumulate the grade 3 part of mv1 mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void geometricBatch_3_2_3(const KvecBatch<T,N,3>& mv1, const KvecBatch<T,N,2>& mv2, KvecBatch<T,N,3>& mv3){
+		mv3.col(0) +=  mv1.col(0)*mv2.col(2) - mv1.col(1)*mv2.col(1) + mv1.col(2)*mv2.col(0);
+		mv3.col(1) +=  mv1.col(0)*mv2.col(5) - mv1.col(2)*mv2.col(3) + mv1.col(3)*mv2.col(1);
+		mv3.col(2) += -mv1.col(0)*mv2.col(4) + mv1.col(1)*mv2.col(3) - mv1.col(3)*mv2.col(0);
+		mv3.col(3) += -mv1.col(1)*mv2.col(5) + mv1.col(2)*mv2.col(4) - mv1.col(3)*mv2.col(2);
+	}
+
+
+	/// \brief Batched version of geometric_3_3_2: accumulate the grade 2 part of mv1 mv2 for the N multivectors of the batch.
+	template<typename T, int N>
+	void geometricBatch_3_3_2(const KvecBatch<T,N,3>& mv1, const KvecBatch<T,N,3>& mv2, KvecBatch<T,N,2>& mv3){
+		mv3.col(0) += -mv1.col(0)*mv2.col(2) + mv1.col(2)*mv2.col(0);
+		mv3.col(1) +=  mv1.col(0)*mv2.col(1) - mv1.col(1)*mv2.col(0);
+		mv3.col(2) += -mv1.col(0)*mv2.col(3) + mv1.col(3)*mv2.col(0);
+		mv3.col(3) +=  mv1.col(1)*mv2.col(2) - mv1.col(2)*mv2.col(1);
+		mv3.col(4) +=  mv1.col(2)*mv2.col(3) - mv1.col(3)*mv2.col(2);
+		mv3.col(5) += -mv1.col(1)*mv2.col(3) + mv1.col(3)*mv2.col(1);
+	}
+
+
+	/// \brief Call the batched outer product between the grade gradeMv1 part of mv1 and the grade gradeMv2 part of mv2, the result is accumulated in the grade gradeMv1+gradeMv2 part of mv3.
+	template<typename T, int N>
+	inline void outerBatchDispatch(const unsigned int gradeMv1, const unsigned int gradeMv2, const KvecBatchTuple<T,N>& mv1, const KvecBatchTuple<T,N>& mv2, KvecBatchTuple<T,N>& mv3){
+		switch(gradeMv1*(algebraDimension+1) + gradeMv2){
+			case 0: outerBatch_0_0<T,N>(std::get<0>(mv1), std::get<0>(mv2), std::get<0>(mv3)); break;
+			case 1: outerBatch_0_1<T,N>(std::get<0>(mv1), std::get<1>(mv2), std::get<1>(mv3)); break;
+			case 2: outerBatch_0_2<T,N>(std::get<0>(mv1), std::get<2>(mv2), std::get<2>(mv3)); break;
+			case 3: outerBatch_0_3<T,N>(std::get<0>(mv1), std::get<3>(mv2), std::get<3>(mv3)); break;
+			case 4: outerBatch_0_4<T,N>(std::get<0>(mv1), std::get<4>(mv2), std::get<4>(mv3)); break;
+			case 5: outerBatch_1_0<T,N>(std::get<1>(mv1), std::get<0>(mv2), std::get<1>(mv3)); break;
+			case 6: outerBatch_1_1<T,N>(std::get<1>(mv1), std::get<1>(mv2), std::get<2>(mv3)); break;
+			case 7: outerBatch_1_2<T,N>(std::get<1>(mv1), std::get<2>(mv2), std::get<3>(mv3)); break;
+			case 8: outerBatch_1_3<T,N>(std::get<1>(mv1), std::get<3>(mv2), std::get<4>(mv3)); break;
+			case 10: outerBatch_2_0<T,N>(std::get<2>(mv1), std::get<0>(mv2), std::get<2>(mv3)); break;
+			case 11: outerBatch_2_1<T,N>(std::get<2>(mv1), std::get<1>(mv2), std::get<3>(mv3)); break;
+			case 12: outerBatch_2_2<T,N>(std::get<2>(mv1), std::get<2>(mv2), std::get<4>(mv3)); break;
+			case 15: outerBatch_3_0<T,N>(std::get<3>(mv1), std::get<0>(mv2), std::get<3>(mv3)); break;
+			case 16: outerBatch_3_1<T,N>(std::get<3>(mv1), std::get<1>(mv2), std::get<4>(mv3)); break;
+			case 20: outerBatch_4_0<T,N>(std::get<4>(mv1), std::get<0>(mv2), std::get<4>(mv3)); break;
+			default: break;
+		}
+	}
+
+
+	/// \brief Call the batched inner product between the grade gradeMv1 part of mv1 and the grade gradeMv2 part of mv2, the result is accumulated in the grade |gradeMv1-gradeMv2| part of mv3.
+	template<typename T, int N>
+	inline void innerBatchDispatch(const unsigned int gradeMv1, const unsigned int gradeMv2, const KvecBatchTuple<T,N>& mv1, const KvecBatchTuple<T,N>& mv2, KvecBatchTuple<T,N>& mv3){
+		switch(gradeMv1*(algebraDimension+1) + gradeMv2){
+			case 0: innerBatch_0_0<T,N>(std::get<0>(mv1), std::get<0>(mv2), std::get<0>(mv3)); break;
+			case 1: innerBatch_0_1<T,N>(std::get<0>(mv1), std::get<1>(mv2), std::get<1>(mv3)); break;
+			case 2: innerBatch_0_2<T,N>(std::get<0>(mv1), std::get<2>(mv2), std::get<2>(mv3)); break;
+			case 3: innerBatch_0_3<T,N>(std::get<0>(mv1), std::get<3>(mv2), std::get<3>(mv3)); break;
+			case 4: innerBatch_0_4<T,N>(std::get<0>(mv1), std::get<4>(mv2), std::get<4>(mv3)); break;
+			case 5: innerBatch_1_0<T,N>(std::get<1>(mv1), std::get<0>(mv2), std::get<1>(mv3)); break;
+			case 6: innerBatch_1_1<T,N>(std::get<1>(mv1), std::get<1>(mv2), std::get<0>(mv3)); break;
+			case 7: innerBatch_1_2<T,N>(std::get<1>(mv1), std::get<2>(mv2), std::get<1>(mv3)); break;
+			case 8: innerBatch_1_3<T,N>(std::get<1>(mv1), std::get<3>(mv2), std::get<2>(mv3)); break;
+			case 9: innerBatch_1_4<T,N>(std::get<1>(mv1), std::get<4>(mv2), std::get<3>(mv3)); break;
+			case 10: innerBatch_2_0<T,N>(std::get<2>(mv1), std::get<0>(mv2), std::get<2>(mv3)); break;
+			case 11: innerBatch_2_1<T,N>(std::get<2>(mv1), std::get<1>(mv2), std::get<1>(mv3)); break;
+			case 12: innerBatch_2_2<T,N>(std::get<2>(mv1), std::get<2>(mv2), std::get<0>(mv3)); break;
+			case 13: innerBatch_2_3<T,N>(std::get<2>(mv1), std::get<3>(mv2), std::get<1>(mv3)); break;
+			case 14: innerBatch_2_4<T,N>(std::get<2>(mv1), std::get<4>(mv2), std::get<2>(mv3)); break;
+			case 15: innerBatch_3_0<T,N>(std::get<3>(mv1), std::get<0>(mv2), std::get<3>(mv3)); break;
+			case 16: innerBatch_3_1<T,N>(std::get<3>(mv1), std::get<1>(mv2), std::get<2>(mv3)); break;
+			case 17: innerBatch_3_2<T,N>(std::get<3>(mv1), std::get<2>(mv2), std::get<1>(mv3)); break;
+			case 18: innerBatch_3_3<T,N>(std::get<3>(mv1), std::get<3>(mv2), std::get<0>(mv3)); break;
+			case 19: innerBatch_3_4<T,N>(std::get<3>(mv1), std::get<4>(mv2), std::get<1>(mv3)); break;
+			case 20: innerBatch_4_0<T,N>(std::get<4>(mv1), std::get<0>(mv2), std::get<4>(mv3)); break;
+			case 21: innerBatch_4_1<T,N>(std::get<4>(mv1), std::get<1>(mv2), std::get<3>(mv3)); break;
+			case 22: innerBatch_4_2<T,N>(std::get<4>(mv1), std::get<2>(mv2), std::get<2>(mv3)); break;
+			case 23: innerBatch_4_3<T,N>(std::get<4>(mv1), std::get<3>(mv2), std::get<1>(mv3)); break;
+			case 24: innerBatch_4_4<T,N>(std::get<4>(mv1), std::get<4>(mv2), std::get<0>(mv3)); break;
+			default: break;
+		}
+	}
+
+
+	/// \brief Call the batched geometric product between the grade gradeMv1 part of mv1 and the grade gradeMv2 part of mv2 (outer part, inner part and the grades in between), the results are accumulated in mv3.
+	template<typename T, int N>
+	inline void geometricBatchDispatch(const unsigned int gradeMv1, const unsigned int gradeMv2, const KvecBatchTuple<T,N>& mv1, const KvecBatchTuple<T,N>& mv2, KvecBatchTuple<T,N>& mv3){
+		switch(gradeMv1*(algebraDimension+1) + gradeMv2){
+			case 0: outerBatch_0_0<T,N>(std::get<0>(mv1), std::get<0>(mv2), std::get<0>(mv3)); break;
+			case 1: outerBatch_0_1<T,N>(std::get<0>(mv1), std::get<1>(mv2), std::get<1>(mv3)); break;
+			case 2: outerBatch_0_2<T,N>(std::get<0>(mv1), std::get<2>(mv2), std::get<2>(mv3)); break;
+			case 3: outerBatch_0_3<T,N>(std::get<0>(mv1), std::get<3>(mv2), std::get<3>(mv3)); break;
+			case 4: outerBatch_0_4<T,N>(std::get<0>(mv1), std::get<4>(mv2), std::get<4>(mv3)); break;
+			case 5: outerBatch_1_0<T,N>(std::get<1>(mv1), std::get<0>(mv2), std::get<1>(mv3)); break;
+			case 6: outerBatch_1_1<T,N>(std::get<1>(mv1), std::get<1>(mv2), std::get<2>(mv3)); innerBatch_1_1<T,N>(std::get<1>(mv1), std::get<1>(mv2), std::get<0>(mv3)); break;
+			case 7: outerBatch_1_2<T,N>(std::get<1>(mv1), std::get<2>(mv2), std::get<3>(mv3)); innerBatch_1_2<T,N>(std::get<1>(mv1), std::get<2>(mv2), std::get<1>(mv3)); break;
+			case 8: outerBatch_1_3<T,N>(std::get<1>(mv1), std::get<3>(mv2), std::get<4>(mv3)); innerBatch_1_3<T,N>(std::get<1>(mv1), std::get<3>(mv2), std::get<2>(mv3)); break;
+			case 9: innerBatch_1_4<T,N>(std::get<1>(mv1), std::get<4>(mv2), std::get<3>(mv3)); break;
+			case 10: outerBatch_2_0<T,N>(std::get<2>(mv1), std::get<0>(mv2), std::get<2>(mv3)); break;
+			case 11: outerBatch_2_1<T,N>(std::get<2>(mv1), std::get<1>(mv2), std::get<3>(mv3)); innerBatch_2_1<T,N>(std::get<2>(mv1), std::get<1>(mv2), std::get<1>(mv3)); break;
+			case 12: outerBatch_2_2<T,N>(std::get<2>(mv1), std::get<2>(mv2), std::get<4>(mv3)); innerBatch_2_2<T,N>(std::get<2>(mv1), std::get<2>(mv2), std::get<0>(mv3)); geometricBatch_2_2_2<T,N>(std::get<2>(mv1), std::get<2>(mv2), std::get<2>(mv3)); break;
+			case 13: innerBatch_2_3<T,N>(std::get<2>(mv1), std::get<3>(mv2), std::get<1>(mv3)); geometricBatch_2_3_3<T,N>(std::get<2>(mv1), std::get<3>(mv2), std::get<3>(mv3)); break;
+			case 14: innerBatch_2_4<T,N>(std::get<2>(mv1), std::get<4>(mv2), std::get<2>(mv3)); break;
+			case 15: outerBatch_3_0<T,N>(std::get<3>(mv1), std::get<0>(mv2), std::get<3>(mv3)); break;
+			case 16: outerBatch_3_1<T,N>(std::get<3>(mv1), std::get<1>(mv2), std::get<4>(mv3)); innerBatch_3_1<T,N>(std::get<3>(mv1), std::get<1>(mv2), std::get<2>(mv3)); break;
+			case 17: innerBatch_3_2<T,N>(std::get<3>(mv1), std::get<2>(mv2), std::get<1>(mv3)); geometricBatch_3_2_3<T,N>(std::get<3>(mv1), std::get<2>(mv2), std::get<3>(mv3)); break;
+			case 18: innerBatch_3_3<T,N>(std::get<3>(mv1), std::get<3>(mv2), std::get<0>(mv3)); geometricBatch_3_3_2<T,N>(std::get<3>(mv1), std::get<3>(mv2), std::get<2>(mv3)); break;
+			case 19: innerBatch_3_4<T,N>(std::get<3>(mv1), std::get<4>(mv2), std::get<1>(mv3)); break;
+			case 20: outerBatch_4_0<T,N>(std::get<4>(mv1), std::get<0>(mv2), std::get<4>(mv3)); break;
+			case 21: innerBatch_4_1<T,N>(std::get<4>(mv1), std::get<1>(mv2), std::get<3>(mv3)); break;
+			case 22: innerBatch_4_2<T,N>(std::get<4>(mv1), std::get<2>(mv2), std::get<2>(mv3)); break;
+			case 23: innerBatch_4_3<T,N>(std::get<4>(mv1), std::get<3>(mv2), std::get<1>(mv3)); break;
+			case 24: innerBatch_4_4<T,N>(std::get<4>(mv1), std::get<4>(mv2), std::get<0>(mv3)); break;
+			default: break;
+		}
+	}
+
+
+	constexpr unsigned int outerBatchGrades[5][5] = {{1,2,4,8,16},{2,4,8,16,0},{4,8,16,0,0},{8,16,0,0,0},{16,0,0,0,0}}; /*!< bitmap of the grades written by outerBatchDispatch for each pair of grades */
+	constexpr unsigned int innerBatchGrades[5][5] = {{1,2,4,8,16},{2,1,2,4,8},{4,2,1,2,4},{8,4,2,1,2},{16,8,4,2,1}}; /*!< bitmap of the grades written by innerBatchDispatch for each pair of grades */
+	constexpr unsigned int geometricBatchGrades[5][5] = {{1,2,4,8,16},{2,5,10,20,8},{4,10,21,10,4},{8,20,10,5,2},{16,8,4,2,1}}; /*!< bitmap of the grades written by geometricBatchDispatch for each pair of grades */
+
+}/// End of Namespace
+
+#endif // C2GA_BATCH_EXPLICIT_HPP__
@@ -61,14 +61,20 @@ namespace c2ga{
 
     constexpr unsigned int binomialArray[5] = {1,4,6,4,1};  /*!< array of the (dimension + 1) first binomial coefficients */
 
+    constexpr int maxKvecSize = 6;  /*!< largest binomial coefficient, i.e. the highest number of components of a k-vector */
+
+    /// \brief storage of the components of a k-vector. The size is dynamic (it depends on the grade) but bounded by maxKvecSize, such that Eigen keeps the coefficients inline, without any heap allocation.
+    template<typename T>
+    using KvecStorage = Eigen::Matrix<T, Eigen::Dynamic, 1, Eigen::ColMajor, maxKvecSize, 1>;
+
+    /// \brief signature of the explicit per grade product functions: mv3 += mv1 (product) mv2.
+    template<typename T>
+    using KvecProductFunction = void (*)(const KvecStorage<T>&, const KvecStorage<T>&, KvecStorage<T>&);
+
     constexpr unsigned int xorIndexToGrade[] = {0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4}; /*!< given a Xor index in a multivector, this array indicates the corresponding grade*/ 
 
     constexpr unsigned int xorIndexToHomogeneousIndex[] = {0,0,1,0,2,1,3,0,3,2,4,1,5,2,3,0}; /*!< given a Xor index in a multivector, this array indicates the corresponding index in the whole homogeneous vector*/
 
-    const std::array<std::vector<unsigned int>, 5> dualPermutations = {{ { 0}, {{ 0,2,1,3}}, {{ 1,0,3,2,5,4}}, {{ 0,2,1,3}}, {0} }}; /*!< array referring to some permutations required to compute the dual. */
-
-    const std::array<Eigen::Matrix<double, Eigen::Dynamic,1>, 5> dualCoefficients = loadFastDualArray<double>(); /*!< array containing some basis change coefficients required to compute the dual */
-    
     template<typename T>
     std::array<T, 16> recursiveDualCoefficients = {{ 1.000000,1.000000,1.000000,-1.000000,-1.000000,1.000000,1.000000,-1.000000,-1.000000,-1.000000,1.000000,1.000000,-1.000000,-1.000000,1.000000,1.000000}}; /*!< array containing the coefficients needed to compute the recursive product like (primal^dual) */
 
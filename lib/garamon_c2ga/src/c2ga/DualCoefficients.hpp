@@ -1,5 +1,5 @@
 // Copyright (c) 2018 by University Paris-Est Marne-la-Vallee
-// Inner.hpp
+// DualCoefficients.hpp
 // This file is part of the Garamon for c2ga.
 // Authors: Stephane Breuils and Vincent Nozick
 // Contact: vincent.nozick@u-pem.fr
@@ -8,7 +8,7 @@
 // A a copy of the MIT License is given along with this program
 
 // \file DualCoefficients.hpp
-// \brief this files generates and load the elements of the fast dual into array of Eigen matrices 
+// \brief compile-time tables of the fast dual: permutation and coefficient of each component, per grade
 // \author V. Nozick, S. Breuils
 
 #ifndef C2GA_DUALCOEFFICIENTS_HPP__
@@ -16,60 +16,16 @@
 #pragma once
 
 
-#include <Eigen/Sparse>
-#include <vector>
-#include <array>
-#include <algorithm>
-#include <iterator>
-#include <sstream>
-
-
 /*!
  * @namespace c2ga
  */
 namespace c2ga{
 
-	/// Decode the string encodedPerGradeMatrixComponents to a vector of T. This vector will contain the coefficients used to compute the dual
-	template<typename T>
-	const std::vector<T> decodeStringOfDualCoefToVecOfT(std::string encodedPerGradeMatrixComponents) {
-	    std::vector<T> resultDecodedGrade;
-	    std::istringstream streamStringOverFloat(encodedPerGradeMatrixComponents);
-	    std::copy(std::istream_iterator<float>(streamStringOverFloat),
-		std::istream_iterator<float>(),
-		std::back_inserter(resultDecodedGrade));
-	    return resultDecodedGrade;
-	}
-
-
-	/// load the coefficients of the dual into array of Eigen matrices 
-	template<typename T>
-	const std::array<Eigen::Matrix<T, Eigen::Dynamic,1>,5> loadFastDualArray() {
-		std::array<Eigen::Matrix<T, Eigen::Dynamic,1>,5> dualArrayCoefficients;
-		std::string stringDualCoefficients="1.000000 1.000000 1.000000 -1.000000 -1.000000 -1.000000 1.000000 -1.000000 1.000000 1.000000 -1.000000 -1.000000 1.000000 -1.000000 1.000000 -1.000000 ";
-		const std::vector<T> vectorDualComponents = decodeStringOfDualCoefToVecOfT<T>(stringDualCoefficients);
-		dualArrayCoefficients[0]= Eigen::Matrix<T, Eigen::Dynamic,1>(1);
-		for(unsigned int i=0;i<1;++i){
-			dualArrayCoefficients[0].coeffRef(i-0) = (T)vectorDualComponents[i]; 
-		}
-		dualArrayCoefficients[1]= Eigen::Matrix<T, Eigen::Dynamic,1>(4);
-		for(unsigned int i=1;i<5;++i){
-			dualArrayCoefficients[1].coeffRef(i-1) = (T)vectorDualComponents[i]; 
-		}
-		dualArrayCoefficients[2]= Eigen::Matrix<T, Eigen::Dynamic,1>(6);
-		for(unsigned int i=5;i<11;++i){
-			dualArrayCoefficients[2].coeffRef(i-5) = (T)vectorDualComponents[i]; 
-		}
-		dualArrayCoefficients[3]= Eigen::Matrix<T, Eigen::Dynamic,1>(4);
-		for(unsigned int i=11;i<15;++i){
-			dualArrayCoefficients[3].coeffRef(i-11) = (T)vectorDualComponents[i]; 
-		}
-		dualArrayCoefficients[4]= Eigen::Matrix<T, Eigen::Dynamic,1>(1);
-		for(unsigned int i=15;i<16;++i){
-			dualArrayCoefficients[4].coeffRef(0) = (T)vectorDualComponents[i]; 
-		}
-		return dualArrayCoefficients;
-	}
+	/// The dual of the k-vector mv (grade k) is the (dimension-k)-vector whose component dualPermutations[k][i] is dualCoefficients[k][dualPermutations[k][i]] * mv[i].
+	/// The rows are padded to the largest k-vector size, only the binomialArray[k] first elements are meaningful.
+	constexpr unsigned int dualPermutations[5][6] = {{0},{0,2,1,3},{1,0,3,2,5,4},{0,2,1,3},{0}}; /*!< array referring to some permutations required to compute the dual. */
 
+	constexpr double dualCoefficients[5][6] = {{1.0},{1.0,1.0,-1.0,-1.0},{-1.0,1.0,-1.0,1.0,1.0,-1.0},{-1.0,1.0,-1.0,1.0},{-1.0}}; /*!< array containing some basis change coefficients required to compute the dual */
 
 }/// End of Namespace
 
@@ -0,0 +1,104 @@
+// Copyright (c) 2018 by University Paris-Est Marne-la-Vallee
+// DualExplicit.hpp
+// This file is part of the Garamon for c2ga.
+// Authors: Stephane Breuils and Vincent Nozick
+// Contact: vincent.nozick@u-pem.fr
+//
+// Licence MIT
+// A a copy of the MIT License is given along with this program
+
+/// \file DualExplicit.hpp
+/// \author Stephane Breuils, Vincent Nozick
+/// \brief Explicit precomputed per grades dual (see dualPermutations and dualCoefficients): each component is a signed move.
+
+
+#ifndef C2GA_DUAL_EXPLICIT_HPP__
+#define C2GA_DUAL_EXPLICIT_HPP__
+#pragma once
+
+#include <Eigen/Core>
+
+#include "c2ga/Constants.hpp"
+
+
+/*!
+ * @namespace c2ga
+ */
+namespace c2ga {
+
+	/// \brief Compute the dual of a homogeneous multivector mv1 of grade 0.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the homogeneous multivector of grade 0 represented as an Eigen::VectorXd
+	/// \param mv2 - the dual of mv1, a homogeneous multivector of grade 4; its components are overwritten
+	template<typename T>
+	inline void dual_0(const KvecStorage<T>& mv1, KvecStorage<T>& mv2){
+		mv2.coeffRef(0) =  mv1.coeff(0);
+	}
+
+	/// \brief Compute the dual of a homogeneous multivector mv1 of grade 1.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the homogeneous multivector of grade 1 represented as an Eigen::VectorXd
+	/// \param mv2 - the dual of mv1, a homogeneous multivector of grade 3; its components are overwritten
+	template<typename T>
+	inline void dual_1(const KvecStorage<T>& mv1, KvecStorage<T>& mv2){
+		mv2.coeffRef(0) =  mv1.coeff(0);
+		mv2.coeffRef(1) =  mv1.coeff(2);
+		mv2.coeffRef(2) = -mv1.coeff(1);
+		mv2.coeffRef(3) = -mv1.coeff(3);
+	}
+
+	/// \brief Compute the dual of a homogeneous multivector mv1 of grade 2.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the homogeneous multivector of grade 2 represented as an Eigen::VectorXd
+	/// \param mv2 - the dual of mv1, a homogeneous multivector of grade 2; its components are overwritten
+	template<typename T>
+	inline void dual_2(const KvecStorage<T>& mv1, KvecStorage<T>& mv2){
+		mv2.coeffRef(0) = -mv1.coeff(1);
+		mv2.coeffRef(1) =  mv1.coeff(0);
+		mv2.coeffRef(2) = -mv1.coeff(3);
+		mv2.coeffRef(3) =  mv1.coeff(2);
+		mv2.coeffRef(4) =  mv1.coeff(5);
+		mv2.coeffRef(5) = -mv1.coeff(4);
+	}
+
+	/// \brief Compute the dual of a homogeneous multivector mv1 of grade 3.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the homogeneous multivector of grade 3 represented as an Eigen::VectorXd
+	/// \param mv2 - the dual of mv1, a homogeneous multivector of grade 1; its components are overwritten
+	template<typename T>
+	inline void dual_3(const KvecStorage<T>& mv1, KvecStorage<T>& mv2){
+		mv2.coeffRef(0) = -mv1.coeff(0);
+		mv2.coeffRef(1) =  mv1.coeff(2);
+		mv2.coeffRef(2) = -mv1.coeff(1);
+		mv2.coeffRef(3) =  mv1.coeff(3);
+	}
+
+	/// \brief Compute the dual of a homogeneous multivector mv1 of grade 4.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the homogeneous multivector of grade 4 represented as an Eigen::VectorXd
+	/// \param mv2 - the dual of mv1, a homogeneous multivector of grade 0; its components are overwritten
+	template<typename T>
+	inline void dual_4(const KvecStorage<T>& mv1, KvecStorage<T>& mv2){
+		mv2.coeffRef(0) = -mv1.coeff(0);
+	}
+
+	/// \brief Call the explicit dual of a homogeneous multivector mv1 of grade gradeMv1.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param gradeMv1 - grade of the k-vector
+	/// \param mv1 - the homogeneous multivector
+	/// \param mv2 - the dual of mv1 (grade algebraDimension-gradeMv1), it has to be sized by the caller
+	template<typename T>
+	inline void dualDispatch(const unsigned int gradeMv1, const KvecStorage<T>& mv1, KvecStorage<T>& mv2){
+		switch(gradeMv1){
+			case 0: dual_0<T>(mv1, mv2); break;
+			case 1: dual_1<T>(mv1, mv2); break;
+			case 2: dual_2<T>(mv1, mv2); break;
+			case 3: dual_3<T>(mv1, mv2); break;
+			case 4: dual_4<T>(mv1, mv2); break;
+			default: break;
+		}
+	}
+
+}/// End of Namespace
+
+#endif // C2GA_DUAL_EXPLICIT_HPP__
@@ -34,7 +34,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1 mv2 whose grade is 2
 	template<typename T>
-	void geometric_2_2_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void geometric_2_2_2(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(2) - mv1.coeff(1)*mv2.coeff(3) - mv1.coeff(2)*mv2.coeff(0) + mv1.coeff(3)*mv2.coeff(1);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(3) + mv1.coeff(1)*mv2.coeff(2) - mv1.coeff(2)*mv2.coeff(1) - mv1.coeff(3)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(4) + mv1.coeff(1)*mv2.coeff(5) - mv1.coeff(4)*mv2.coeff(0) - mv1.coeff(5)*mv2.coeff(1);
@@ -50,7 +50,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1 mv2 whose grade is 3
 	template<typename T>
-	void geometric_2_3_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void geometric_2_3_3(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(2) + mv1.coeff(1)*mv2.coeff(1) - mv1.coeff(2)*mv2.coeff(0);
 		mv3.coeffRef(1) += -mv1.coeff(1)*mv2.coeff(3) + mv1.coeff(3)*mv2.coeff(2) - mv1.coeff(5)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(3)*mv2.coeff(1) + mv1.coeff(4)*mv2.coeff(0);
@@ -64,7 +64,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1 mv2 whose grade is 3
 	template<typename T>
-	void geometric_3_2_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void geometric_3_2_3(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(2) - mv1.coeff(1)*mv2.coeff(1) + mv1.coeff(2)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(5) - mv1.coeff(2)*mv2.coeff(3) + mv1.coeff(3)*mv2.coeff(1);
 		mv3.coeffRef(2) += -mv1.coeff(0)*mv2.coeff(4) + mv1.coeff(1)*mv2.coeff(3) - mv1.coeff(3)*mv2.coeff(0);
@@ -78,7 +78,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1 mv2 whose grade is 2
 	template<typename T>
-	void geometric_3_3_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void geometric_3_3_2(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(2) + mv1.coeff(2)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(1) - mv1.coeff(1)*mv2.coeff(0);
 		mv3.coeffRef(2) += -mv1.coeff(0)*mv2.coeff(3) + mv1.coeff(3)*mv2.coeff(0);
@@ -88,9 +88,28 @@ namespace c2ga {
 	}
 
 
-	
+	/// \brief Call the explicit geometric product part of grade gradeMv3 between two homogeneous multivectors mv1 (grade gradeMv1) and mv2 (grade gradeMv2). Only the grades that are neither the inner nor the outer part are handled, the other cases do nothing.
+	/// \tparam the type of value that we manipulate, either float or double or something else.
+	/// \param gradeMv3 - grade of the resulting k-vector
+	/// \param gradeMv1 - grade of the first k-vector
+	/// \param gradeMv2 - grade of the second k-vector
+	/// \param mv1 - the first homogeneous multivector
+	/// \param mv2 - the second homogeneous multivector
+	/// \param mv3 - the homogeneous multivector in which the grade gradeMv3 part of mv1 mv2 is accumulated
+	template<typename T>
+	inline void geometricDispatch(const unsigned int gradeMv3, const unsigned int gradeMv1, const unsigned int gradeMv2, const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		switch((gradeMv3*(algebraDimension+1) + gradeMv1)*(algebraDimension+1) + gradeMv2){
+			case 62: geometric_2_2_2<T>(mv1, mv2, mv3); break;
+			case 68: geometric_3_3_2<T>(mv1, mv2, mv3); break;
+			case 88: geometric_2_3_3<T>(mv1, mv2, mv3); break;
+			case 92: geometric_3_2_3<T>(mv1, mv2, mv3); break;
+			default: break;
+		}
+	}
+
+
     template<typename T>
-	std::array<std::array<std::array<std::function<void(const Eigen::Matrix<T, Eigen::Dynamic, 1> & , const Eigen::Matrix<T, Eigen::Dynamic, 1> & , Eigen::Matrix<T, Eigen::Dynamic, 1>&)>, 5>, 5>, 5> geometricFunctionsContainer =
+	constexpr std::array<std::array<std::array<KvecProductFunction<T>, 5>, 5>, 5> geometricFunctionsContainer =
 	{{
 		{{
 			{{{},{},{},{},{}}},
@@ -34,7 +34,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 0
 	template<typename T>
-	void inner_0_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_0_0(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(0);
 	}
 
@@ -45,7 +45,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
 	template<typename T>
-	void inner_0_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_0_1(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3 += mv1.coeff(0)*mv2;
 	}
 
@@ -56,7 +56,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 2
 	template<typename T>
-	void inner_0_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_0_2(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3 += mv1.coeff(0)*mv2;
 	}
 
@@ -67,7 +67,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 3
 	template<typename T>
-	void inner_0_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_0_3(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3 += mv1.coeff(0)*mv2;
 	}
 
@@ -78,7 +78,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 4
 	template<typename T>
-	void inner_0_4(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_0_4(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3 += mv1.coeff(0)*mv2;
 	}
 
@@ -89,7 +89,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
 	template<typename T>
-	void inner_1_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_1_0(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3 += mv1*mv2.coeff(0);
 	}
 
@@ -100,7 +100,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 0
 	template<typename T>
-	void inner_1_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_1_1(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(3) + mv1.coeff(1)*mv2.coeff(1) + mv1.coeff(2)*mv2.coeff(2) - mv1.coeff(3)*mv2.coeff(0);
 	}
 
@@ -111,7 +111,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
 	template<typename T>
-	void inner_1_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_1_2(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(2) - mv1.coeff(1)*mv2.coeff(0) - mv1.coeff(2)*mv2.coeff(1);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(4) - mv1.coeff(2)*mv2.coeff(3) - mv1.coeff(3)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(5) + mv1.coeff(1)*mv2.coeff(3) - mv1.coeff(3)*mv2.coeff(1);
@@ -125,7 +125,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 2
 	template<typename T>
-	void inner_1_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_1_3(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(1) + mv1.coeff(2)*mv2.coeff(0);
 		mv3.coeffRef(1) += -mv1.coeff(0)*mv2.coeff(2) - mv1.coeff(1)*mv2.coeff(0);
 		mv3.coeffRef(2) += -mv1.coeff(1)*mv2.coeff(1) - mv1.coeff(2)*mv2.coeff(2);
@@ -141,7 +141,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 3
 	template<typename T>
-	void inner_1_4(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_1_4(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(2)*mv2.coeff(0);
 		mv3.coeffRef(2) += -mv1.coeff(1)*mv2.coeff(0);
@@ -155,7 +155,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 2
 	template<typename T>
-	void inner_2_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_2_0(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3 += mv1*mv2.coeff(0);
 	}
 
@@ -166,7 +166,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
 	template<typename T>
-	void inner_2_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_2_1(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(1) + mv1.coeff(1)*mv2.coeff(2) - mv1.coeff(2)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(3) + mv1.coeff(3)*mv2.coeff(2) - mv1.coeff(4)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(1)*mv2.coeff(3) - mv1.coeff(3)*mv2.coeff(1) - mv1.coeff(5)*mv2.coeff(0);
@@ -180,7 +180,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 0
 	template<typename T>
-	void inner_2_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_2_2(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(4) - mv1.coeff(1)*mv2.coeff(5) + mv1.coeff(2)*mv2.coeff(2) - mv1.coeff(3)*mv2.coeff(3) - mv1.coeff(4)*mv2.coeff(0) - mv1.coeff(5)*mv2.coeff(1);
 	}
 
@@ -191,7 +191,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
 	template<typename T>
-	void inner_2_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_2_3(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(1) - mv1.coeff(1)*mv2.coeff(2) - mv1.coeff(3)*mv2.coeff(0);
 		mv3.coeffRef(1) += -mv1.coeff(1)*mv2.coeff(3) - mv1.coeff(2)*mv2.coeff(1) + mv1.coeff(5)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(2)*mv2.coeff(2) - mv1.coeff(4)*mv2.coeff(0);
@@ -205,7 +205,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 2
 	template<typename T>
-	void inner_2_4(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_2_4(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(1)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(0);
 		mv3.coeffRef(2) += -mv1.coeff(3)*mv2.coeff(0);
@@ -221,7 +221,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 3
 	template<typename T>
-	void inner_3_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_3_0(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3 += mv1*mv2.coeff(0);
 	}
 
@@ -232,7 +232,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 2
 	template<typename T>
-	void inner_3_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_3_1(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(2) - mv1.coeff(1)*mv2.coeff(0);
 		mv3.coeffRef(1) += -mv1.coeff(0)*mv2.coeff(1) - mv1.coeff(2)*mv2.coeff(0);
 		mv3.coeffRef(2) += -mv1.coeff(1)*mv2.coeff(1) - mv1.coeff(2)*mv2.coeff(2);
@@ -248,7 +248,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
 	template<typename T>
-	void inner_3_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_3_2(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(1)*mv2.coeff(0) - mv1.coeff(2)*mv2.coeff(1);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(5) - mv1.coeff(1)*mv2.coeff(2) - mv1.coeff(3)*mv2.coeff(1);
 		mv3.coeffRef(2) += -mv1.coeff(0)*mv2.coeff(4) - mv1.coeff(2)*mv2.coeff(2) + mv1.coeff(3)*mv2.coeff(0);
@@ -262,7 +262,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 0
 	template<typename T>
-	void inner_3_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_3_3(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(3) + mv1.coeff(1)*mv2.coeff(1) + mv1.coeff(2)*mv2.coeff(2) + mv1.coeff(3)*mv2.coeff(0);
 	}
 
@@ -273,7 +273,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
 	template<typename T>
-	void inner_3_4(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_3_4(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(2)*mv2.coeff(0);
 		mv3.coeffRef(2) += -mv1.coeff(1)*mv2.coeff(0);
@@ -287,7 +287,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 4
 	template<typename T>
-	void inner_4_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_4_0(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3 += mv1*mv2.coeff(0);
 	}
 
@@ -298,7 +298,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 3
 	template<typename T>
-	void inner_4_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_4_1(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(0);
 		mv3.coeffRef(1) += -mv1.coeff(0)*mv2.coeff(2);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(1);
@@ -312,7 +312,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 2
 	template<typename T>
-	void inner_4_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_4_2(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(1);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(0);
 		mv3.coeffRef(2) += -mv1.coeff(0)*mv2.coeff(3);
@@ -328,7 +328,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
 	template<typename T>
-	void inner_4_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_4_3(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(0);
 		mv3.coeffRef(1) += -mv1.coeff(0)*mv2.coeff(2);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(1);
@@ -342,14 +342,53 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 0
 	template<typename T>
-	void inner_4_4(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void inner_4_4(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(0);
 	}
 
 
-	
+	/// \brief Call the explicit inner product between two homogeneous multivectors mv1 (grade gradeMv1) and mv2 (grade gradeMv2). The switch is resolved at compile time when the grades are known, else it compiles to a jump table; in both cases the kernel can be inlined.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param gradeMv1 - grade of the first k-vector
+	/// \param gradeMv2 - grade of the second k-vector
+	/// \param mv1 - the first homogeneous multivector
+	/// \param mv2 - the second homogeneous multivector
+	/// \param mv3 - the homogeneous multivector in which the result mv1.mv2 is accumulated
+	template<typename T>
+	inline void innerDispatch(const unsigned int gradeMv1, const unsigned int gradeMv2, const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		switch(gradeMv1*(algebraDimension+1) + gradeMv2){
+			case 0: inner_0_0<T>(mv1, mv2, mv3); break;
+			case 1: inner_0_1<T>(mv1, mv2, mv3); break;
+			case 2: inner_0_2<T>(mv1, mv2, mv3); break;
+			case 3: inner_0_3<T>(mv1, mv2, mv3); break;
+			case 4: inner_0_4<T>(mv1, mv2, mv3); break;
+			case 5: inner_1_0<T>(mv1, mv2, mv3); break;
+			case 6: inner_1_1<T>(mv1, mv2, mv3); break;
+			case 7: inner_1_2<T>(mv1, mv2, mv3); break;
+			case 8: inner_1_3<T>(mv1, mv2, mv3); break;
+			case 9: inner_1_4<T>(mv1, mv2, mv3); break;
+			case 10: inner_2_0<T>(mv1, mv2, mv3); break;
+			case 11: inner_2_1<T>(mv1, mv2, mv3); break;
+			case 12: inner_2_2<T>(mv1, mv2, mv3); break;
+			case 13: inner_2_3<T>(mv1, mv2, mv3); break;
+			case 14: inner_2_4<T>(mv1, mv2, mv3); break;
+			case 15: inner_3_0<T>(mv1, mv2, mv3); break;
+			case 16: inner_3_1<T>(mv1, mv2, mv3); break;
+			case 17: inner_3_2<T>(mv1, mv2, mv3); break;
+			case 18: inner_3_3<T>(mv1, mv2, mv3); break;
+			case 19: inner_3_4<T>(mv1, mv2, mv3); break;
+			case 20: inner_4_0<T>(mv1, mv2, mv3); break;
+			case 21: inner_4_1<T>(mv1, mv2, mv3); break;
+			case 22: inner_4_2<T>(mv1, mv2, mv3); break;
+			case 23: inner_4_3<T>(mv1, mv2, mv3); break;
+			case 24: inner_4_4<T>(mv1, mv2, mv3); break;
+			default: break;
+		}
+	}
+
+
     template<typename T>
-	std::array<std::array<std::function<void(const Eigen::Matrix<T, Eigen::Dynamic, 1> & , const Eigen::Matrix<T, Eigen::Dynamic, 1> & , Eigen::Matrix<T, Eigen::Dynamic, 1>&)>, 5>, 5> innerFunctionsContainer = {{
+	constexpr std::array<std::array<KvecProductFunction<T>, 5>, 5> innerFunctionsContainer = {{
 		{{inner_0_0<T>,inner_0_1<T>,inner_0_2<T>,inner_0_3<T>,inner_0_4<T>}},
 		{{inner_1_0<T>,inner_1_1<T>,inner_1_2<T>,inner_1_3<T>,inner_1_4<T>}},
 		{{inner_2_0<T>,inner_2_1<T>,inner_2_2<T>,inner_2_3<T>,inner_2_4<T>}},
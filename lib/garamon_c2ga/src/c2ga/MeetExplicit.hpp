@@ -0,0 +1,237 @@
+// Copyright (c) 2018 by University Paris-Est Marne-la-Vallee
+// MeetExplicit.hpp
+// This file is part of the Garamon for c2ga.
+// Authors: Stephane Breuils and Vincent Nozick
+// Contact: vincent.nozick@u-pem.fr
+//
+// Licence MIT
+// A a copy of the MIT License is given along with this program
+
+/// \file MeetExplicit.hpp
+/// \author Stephane Breuils, Vincent Nozick
+/// \brief Explicit precomputed per grades meet (regressive product), i.e. !((!mv1)^(!mv2)) computed directly from the primal k-vectors.
+
+
+#ifndef C2GA_MEET_PRODUCT_EXPLICIT_HPP__
+#define C2GA_MEET_PRODUCT_EXPLICIT_HPP__
+#pragma once
+
+#include <Eigen/Core>
+
+#include "c2ga/Mvec.hpp"
+#include "c2ga/Constants.hpp"
+
+
+/*!
+ * @namespace c2ga
+ */
+namespace c2ga {
+    template<typename T> class Mvec;
+
+	/// \brief Compute the meet (regressive product) between two homogeneous multivectors mv1 (grade 0) and mv2 (grade 4), i.e. !((!mv1)^(!mv2)) without computing the duals.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the first homogeneous multivector of grade 0 represented as an Eigen::VectorXd
+	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
+	/// \param mv3 - the result of the meet of mv1 and mv2, which is also a homogeneous multivector of grade 0
+	template<typename T>
+	void meet_0_4(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		mv3 += mv1*mv2.coeff(0);
+	}
+
+
+	/// \brief Compute the meet (regressive product) between two homogeneous multivectors mv1 (grade 1) and mv2 (grade 3), i.e. !((!mv1)^(!mv2)) without computing the duals.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the first homogeneous multivector of grade 1 represented as an Eigen::VectorXd
+	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
+	/// \param mv3 - the result of the meet of mv1 and mv2, which is also a homogeneous multivector of grade 0
+	template<typename T>
+	void meet_1_3(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(3) + mv1.coeff(1)*mv2.coeff(2) - mv1.coeff(2)*mv2.coeff(1) + mv1.coeff(3)*mv2.coeff(0);
+	}
+
+
+	/// \brief Compute the meet (regressive product) between two homogeneous multivectors mv1 (grade 1) and mv2 (grade 4), i.e. !((!mv1)^(!mv2)) without computing the duals.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the first homogeneous multivector of grade 1 represented as an Eigen::VectorXd
+	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
+	/// \param mv3 - the result of the meet of mv1 and mv2, which is also a homogeneous multivector of grade 1
+	template<typename T>
+	void meet_1_4(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		mv3 += mv1*mv2.coeff(0);
+	}
+
+
+	/// \brief Compute the meet (regressive product) between two homogeneous multivectors mv1 (grade 2) and mv2 (grade 2), i.e. !((!mv1)^(!mv2)) without computing the duals.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the first homogeneous multivector of grade 2 represented as an Eigen::VectorXd
+	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
+	/// \param mv3 - the result of the meet of mv1 and mv2, which is also a homogeneous multivector of grade 0
+	template<typename T>
+	void meet_2_2(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(5) - mv1.coeff(1)*mv2.coeff(4) + mv1.coeff(2)*mv2.coeff(3) + mv1.coeff(3)*mv2.coeff(2) - mv1.coeff(4)*mv2.coeff(1) + mv1.coeff(5)*mv2.coeff(0);
+	}
+
+
+	/// \brief Compute the meet (regressive product) between two homogeneous multivectors mv1 (grade 2) and mv2 (grade 3), i.e. !((!mv1)^(!mv2)) without computing the duals.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the first homogeneous multivector of grade 2 represented as an Eigen::VectorXd
+	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
+	/// \param mv3 - the result of the meet of mv1 and mv2, which is also a homogeneous multivector of grade 1
+	template<typename T>
+	void meet_2_3(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(2) - mv1.coeff(1)*mv2.coeff(1) + mv1.coeff(2)*mv2.coeff(0);
+		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(3)*mv2.coeff(1) + mv1.coeff(4)*mv2.coeff(0);
+		mv3.coeffRef(2) +=  mv1.coeff(1)*mv2.coeff(3) - mv1.coeff(3)*mv2.coeff(2) + mv1.coeff(5)*mv2.coeff(0);
+		mv3.coeffRef(3) +=  mv1.coeff(2)*mv2.coeff(3) - mv1.coeff(4)*mv2.coeff(2) + mv1.coeff(5)*mv2.coeff(1);
+	}
+
+
+	/// \brief Compute the meet (regressive product) between two homogeneous multivectors mv1 (grade 2) and mv2 (grade 4), i.e. !((!mv1)^(!mv2)) without computing the duals.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the first homogeneous multivector of grade 2 represented as an Eigen::VectorXd
+	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
+	/// \param mv3 - the result of the meet of mv1 and mv2, which is also a homogeneous multivector of grade 2
+	template<typename T>
+	void meet_2_4(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		mv3 += mv1*mv2.coeff(0);
+	}
+
+
+	/// \brief Compute the meet (regressive product) between two homogeneous multivectors mv1 (grade 3) and mv2 (grade 1), i.e. !((!mv1)^(!mv2)) without computing the duals.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the first homogeneous multivector of grade 3 represented as an Eigen::VectorXd
+	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
+	/// \param mv3 - the result of the meet of mv1 and mv2, which is also a homogeneous multivector of grade 0
+	template<typename T>
+	void meet_3_1(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(3) + mv1.coeff(1)*mv2.coeff(2) - mv1.coeff(2)*mv2.coeff(1) + mv1.coeff(3)*mv2.coeff(0);
+	}
+
+
+	/// \brief Compute the meet (regressive product) between two homogeneous multivectors mv1 (grade 3) and mv2 (grade 2), i.e. !((!mv1)^(!mv2)) without computing the duals.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the first homogeneous multivector of grade 3 represented as an Eigen::VectorXd
+	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
+	/// \param mv3 - the result of the meet of mv1 and mv2, which is also a homogeneous multivector of grade 1
+	template<typename T>
+	void meet_3_2(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(2) - mv1.coeff(1)*mv2.coeff(1) + mv1.coeff(2)*mv2.coeff(0);
+		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(4) - mv1.coeff(1)*mv2.coeff(3) + mv1.coeff(3)*mv2.coeff(0);
+		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(5) - mv1.coeff(2)*mv2.coeff(3) + mv1.coeff(3)*mv2.coeff(1);
+		mv3.coeffRef(3) +=  mv1.coeff(1)*mv2.coeff(5) - mv1.coeff(2)*mv2.coeff(4) + mv1.coeff(3)*mv2.coeff(2);
+	}
+
+
+	/// \brief Compute the meet (regressive product) between two homogeneous multivectors mv1 (grade 3) and mv2 (grade 3), i.e. !((!mv1)^(!mv2)) without computing the duals.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the first homogeneous multivector of grade 3 represented as an Eigen::VectorXd
+	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
+	/// \param mv3 - the result of the meet of mv1 and mv2, which is also a homogeneous multivector of grade 2
+	template<typename T>
+	void meet_3_3(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(1) + mv1.coeff(1)*mv2.coeff(0);
+		mv3.coeffRef(1) += -mv1.coeff(0)*mv2.coeff(2) + mv1.coeff(2)*mv2.coeff(0);
+		mv3.coeffRef(2) += -mv1.coeff(1)*mv2.coeff(2) + mv1.coeff(2)*mv2.coeff(1);
+		mv3.coeffRef(3) += -mv1.coeff(0)*mv2.coeff(3) + mv1.coeff(3)*mv2.coeff(0);
+		mv3.coeffRef(4) += -mv1.coeff(1)*mv2.coeff(3) + mv1.coeff(3)*mv2.coeff(1);
+		mv3.coeffRef(5) += -mv1.coeff(2)*mv2.coeff(3) + mv1.coeff(3)*mv2.coeff(2);
+	}
+
+
+	/// \brief Compute the meet (regressive product) between two homogeneous multivectors mv1 (grade 3) and mv2 (grade 4), i.e. !((!mv1)^(!mv2)) without computing the duals.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the first homogeneous multivector of grade 3 represented as an Eigen::VectorXd
+	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
+	/// \param mv3 - the result of the meet of mv1 and mv2, which is also a homogeneous multivector of grade 3
+	template<typename T>
+	void meet_3_4(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		mv3 += mv1*mv2.coeff(0);
+	}
+
+
+	/// \brief Compute the meet (regressive product) between two homogeneous multivectors mv1 (grade 4) and mv2 (grade 0), i.e. !((!mv1)^(!mv2)) without computing the duals.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the first homogeneous multivector of grade 4 represented as an Eigen::VectorXd
+	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
+	/// \param mv3 - the result of the meet of mv1 and mv2, which is also a homogeneous multivector of grade 0
+	template<typename T>
+	void meet_4_0(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		mv3 += mv1.coeff(0)*mv2;
+	}
+
+
+	/// \brief Compute the meet (regressive product) between two homogeneous multivectors mv1 (grade 4) and mv2 (grade 1), i.e. !((!mv1)^(!mv2)) without computing the duals.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the first homogeneous multivector of grade 4 represented as an Eigen::VectorXd
+	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
+	/// \param mv3 - the result of the meet of mv1 and mv2, which is also a homogeneous multivector of grade 1
+	template<typename T>
+	void meet_4_1(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		mv3 += mv1.coeff(0)*mv2;
+	}
+
+
+	/// \brief Compute the meet (regressive product) between two homogeneous multivectors mv1 (grade 4) and mv2 (grade 2), i.e. !((!mv1)^(!mv2)) without computing the duals.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the first homogeneous multivector of grade 4 represented as an Eigen::VectorXd
+	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
+	/// \param mv3 - the result of the meet of mv1 and mv2, which is also a homogeneous multivector of grade 2
+	template<typename T>
+	void meet_4_2(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		mv3 += mv1.coeff(0)*mv2;
+	}
+
+
+	/// \brief Compute the meet (regressive product) between two homogeneous multivectors mv1 (grade 4) and mv2 (grade 3), i.e. !((!mv1)^(!mv2)) without computing the duals.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the first homogeneous multivector of grade 4 represented as an Eigen::VectorXd
+	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
+	/// \param mv3 - the result of the meet of mv1 and mv2, which is also a homogeneous multivector of grade 3
+	template<typename T>
+	void meet_4_3(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		mv3 += mv1.coeff(0)*mv2;
+	}
+
+
+	/// \brief Compute the meet (regressive product) between two homogeneous multivectors mv1 (grade 4) and mv2 (grade 4), i.e. !((!mv1)^(!mv2)) without computing the duals.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param mv1 - the first homogeneous multivector of grade 4 represented as an Eigen::VectorXd
+	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
+	/// \param mv3 - the result of the meet of mv1 and mv2, which is also a homogeneous multivector of grade 4
+	template<typename T>
+	void meet_4_4(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		mv3 += mv1.coeff(0)*mv2;
+	}
+
+	/// \brief Call the explicit meet between two homogeneous multivectors mv1 (grade gradeMv1) and mv2 (grade gradeMv2). The result has the grade gradeMv1+gradeMv2-algebraDimension, the pairs whose grades sum to less than algebraDimension have a null meet and do nothing.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param gradeMv1 - grade of the first k-vector
+	/// \param gradeMv2 - grade of the second k-vector
+	/// \param mv1 - the first homogeneous multivector
+	/// \param mv2 - the second homogeneous multivector
+	/// \param mv3 - the homogeneous multivector in which the meet of mv1 and mv2 is accumulated
+	template<typename T>
+	inline void meetDispatch(const unsigned int gradeMv1, const unsigned int gradeMv2, const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		switch(gradeMv1*(algebraDimension+1) + gradeMv2){
+			case 4: meet_0_4<T>(mv1, mv2, mv3); break;
+			case 8: meet_1_3<T>(mv1, mv2, mv3); break;
+			case 9: meet_1_4<T>(mv1, mv2, mv3); break;
+			case 12: meet_2_2<T>(mv1, mv2, mv3); break;
+			case 13: meet_2_3<T>(mv1, mv2, mv3); break;
+			case 14: meet_2_4<T>(mv1, mv2, mv3); break;
+			case 16: meet_3_1<T>(mv1, mv2, mv3); break;
+			case 17: meet_3_2<T>(mv1, mv2, mv3); break;
+			case 18: meet_3_3<T>(mv1, mv2, mv3); break;
+			case 19: meet_3_4<T>(mv1, mv2, mv3); break;
+			case 20: meet_4_0<T>(mv1, mv2, mv3); break;
+			case 21: meet_4_1<T>(mv1, mv2, mv3); break;
+			case 22: meet_4_2<T>(mv1, mv2, mv3); break;
+			case 23: meet_4_3<T>(mv1, mv2, mv3); break;
+			case 24: meet_4_4<T>(mv1, mv2, mv3); break;
+			default: break;
+		}
+	}
+
+}/// End of Namespace
+
+#endif // C2GA_MEET_PRODUCT_EXPLICIT_HPP__
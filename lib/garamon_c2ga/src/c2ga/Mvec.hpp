@@ -19,10 +19,13 @@
 
 // External Includes
 #include <Eigen/Core>
-#include <list>
+#include <array>
+#include <algorithm>
+#include <iterator>
 #include <iostream>
 #include <cmath>
 #include <limits>
+#include <type_traits>
 
 // Internal Includes
 #include "c2ga/Utility.hpp"
@@ -35,6 +38,8 @@
 #include "c2ga/OuterExplicit.hpp"
 #include "c2ga/InnerExplicit.hpp"
 #include "c2ga/GeometricExplicit.hpp"
+#include "c2ga/MeetExplicit.hpp"
+#include "c2ga/DualExplicit.hpp"
 
 /*!
  * @namespace c2ga
@@ -47,7 +52,9 @@ namespace c2ga{
     template<class T>
     struct Kvec{
 
-        Eigen::Matrix<T, Eigen::Dynamic, 1> vec;  /*!< dynamic vector of Eigen Library */
+        static_assert(KvecStorage<T>::MaxRowsAtCompileTime != Eigen::Dynamic, "the k-vector storage must stay inline: Mvec temporaries are not allowed to allocate");
+
+        KvecStorage<T> vec;  /*!< dynamic vector of Eigen Library, with inline (bounded) storage */
 
         unsigned int grade; /*!< grade k of the k-vector */
 
@@ -58,14 +65,75 @@ namespace c2ga{
     };
 
 
+    /// \class KvecArray
+    /// \brief fixed capacity container of k-vectors sorted by increasing grade. A multivector has at most one k-vector per grade, so the k-vectors are stored inline (no heap allocation); the interface is the subset of std::list used by Mvec.
+    template<class T>
+    class KvecArray{
+
+    public:
+        typedef Kvec<T>* iterator;
+        typedef const Kvec<T>* const_iterator;
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        KvecArray() : count(0) {}
+
+        iterator begin() { return data.data(); }
+        iterator end() { return data.data() + count; }
+        const_iterator begin() const { return data.data(); }
+        const_iterator end() const { return data.data() + count; }
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+        unsigned int size() const { return count; }
+        bool empty() const { return count == 0; }
+        void clear() { count = 0; }
+
+        /// \brief append a k-vector, the caller has to preserve the grade ordering.
+        void push_back(const Kvec<T> &kvec) {
+            data[count++] = kvec;
+        }
+
+        /// \brief insert a k-vector before pos, the following k-vectors are shifted.
+        /// \return an iterator on the inserted k-vector
+        iterator insert(iterator pos, const Kvec<T> &kvec) {
+            for(iterator it = end(); it != pos; --it)
+                *it = *(it-1);
+            *pos = kvec;
+            ++count;
+            return pos;
+        }
+
+        /// \brief remove the k-vector at pos, the following k-vectors are shifted.
+        /// \return an iterator on the k-vector that followed the erased one
+        iterator erase(iterator pos) {
+            for(iterator it = pos+1; it != end(); ++it)
+                *(it-1) = *it;
+            --count;
+            return pos;
+        }
+
+        bool operator == (const KvecArray<T>& other) const {
+            return std::equal(begin(), end(), other.begin(), other.end());
+        }
+
+    private:
+        std::array<Kvec<T>, algebraDimension+1> data; /*!< one slot per grade */
+        unsigned int count;                           /*!< number of k-vectors in use */
+    };
+
+
 
     /// \class Mvec
     /// \brief class defining multivectors.
+    /// A multivector never allocates memory: its k-vectors live in a fixed capacity KvecArray, so copies and temporaries only cost a stack copy and are safe to create from several threads without any allocator contention.
     template<typename T = double>
     class Mvec {
 
     protected:
-        std::list<Kvec<T>> mvData;  /*!< set of k-vectors, mapped by grade */
+        KvecArray<T> mvData;        /*!< set of k-vectors, sorted by grade and stored inline */
         unsigned int gradeBitmap;   /*!< ith bit to 1 if grade i is contained in the multivector */
 
     public:
@@ -90,9 +158,9 @@ namespace c2ga{
         template<typename U>
         Mvec<T>(const Mvec<U> &mv);
 
-        /// \brief Constructor of Mvec from a scalar
+        /// \brief Constructor of Mvec from a scalar (only arithmetic types, so that other objects like expressions are not silently taken as scalars)
         /// \param val - scalar value
-        template<typename S>
+        template<typename S, typename = typename std::enable_if<std::is_arithmetic<S>::value>::type>
         Mvec(const S val);
 
         /// Destructor
@@ -111,13 +179,36 @@ namespace c2ga{
         /// \brief defines the addition between two Mvec
         /// \param mv2 - second operand of type Mvec
         /// \return this + mv2
-        Mvec operator+(const Mvec &mv2) const;
+        Mvec operator+(const Mvec &mv2) const &;
+
+        /// \brief defines the addition between two Mvec, reusing the storage of this expiring multivector
+        /// \param mv2 - second operand of type Mvec
+        /// \return this + mv2
+        Mvec operator+(const Mvec &mv2) &&;
+
+        /// \brief defines the addition between two expiring Mvec, reusing the storage of the first one
+        /// \param mv2 - second operand of type Mvec
+        /// \return this + mv2
+        Mvec operator+(Mvec &&mv2) &&;
+
+        /// \brief defines the addition between a Mvec and an expiring Mvec, reusing the storage of the second one
+        /// \param mv1 - first operand of type Mvec
+        /// \param mv2 - second operand of type Mvec
+        /// \return mv1 + mv2
+        template<typename U>
+        friend Mvec<U> operator+(const Mvec<U> &mv1, Mvec<U> &&mv2);
 
         /// \brief defines the addition between a Mvec and a scalar
         /// \param value - second operand (scalar)
         /// \return this + scalar
         template<typename S>
-        Mvec operator+(const S &value) const;
+        Mvec operator+(const S &value) const &;
+
+        /// \brief defines the addition between an expiring Mvec and a scalar, reusing its storage
+        /// \param value - second operand (scalar)
+        /// \return this + scalar
+        template<typename S, typename = typename std::enable_if<std::is_arithmetic<S>::value>::type>
+        Mvec operator+(const S &value) &&;
 
         /// \brief defines the addition between a scalar and a Mvec
         /// \param value a scalar
@@ -137,16 +228,45 @@ namespace c2ga{
         template<typename U>
         friend Mvec<U> operator-(const Mvec<U> &mv); // unary operator -mv1
 
+        /// \brief defines the opposite of an expiring multivector, negated in place
+        /// \param mv: operand of type Mvec
+        /// \return -mv
+        template<typename U>
+        friend Mvec<U> operator-(Mvec<U> &&mv);
+
         /// \brief defines the difference between two Mvec
         /// \param mv2 - second operand of type Mvec
         /// \return this - mv2
-        Mvec<T> operator-(const Mvec<T> &mv2) const;
+        Mvec<T> operator-(const Mvec<T> &mv2) const &;
+
+        /// \brief defines the difference between two Mvec, reusing the storage of this expiring multivector
+        /// \param mv2 - second operand of type Mvec
+        /// \return this - mv2
+        Mvec<T> operator-(const Mvec<T> &mv2) &&;
+
+        /// \brief defines the difference between two expiring Mvec, reusing the storage of the first one
+        /// \param mv2 - second operand of type Mvec
+        /// \return this - mv2
+        Mvec<T> operator-(Mvec<T> &&mv2) &&;
+
+        /// \brief defines the difference between a Mvec and an expiring Mvec, reusing the storage of the second one
+        /// \param mv1 - first operand of type Mvec
+        /// \param mv2 - second operand of type Mvec
+        /// \return mv1 - mv2
+        template<typename U>
+        friend Mvec<U> operator-(const Mvec<U> &mv1, Mvec<U> &&mv2);
 
         /// \brief defines the difference between a Mvec and a scalar
         /// \param value - second operand (scalar)
         /// \return this - scalar
         template<typename S>
-        Mvec operator-(const S &value) const;
+        Mvec operator-(const S &value) const &;
+
+        /// \brief defines the difference between an expiring Mvec and a scalar, reusing its storage
+        /// \param value - second operand (scalar)
+        /// \return this - scalar
+        template<typename S, typename = typename std::enable_if<std::is_arithmetic<S>::value>::type>
+        Mvec operator-(const S &value) &&;
 
         /// \brief defines the difference between a scalar and a Mvec
         /// \param value a scalar
@@ -169,7 +289,13 @@ namespace c2ga{
         /// \param value - a scalar
         /// \return this^value
         template<typename S>
-        Mvec operator^(const S &value) const;
+        Mvec operator^(const S &value) const &;
+
+        /// \brief defines the outer product between an expiring multivector and a scalar, reusing its storage (only arithmetic scalars, so that an expiring Mvec operand selects the multivector product)
+        /// \param value - a scalar
+        /// \return this^value
+        template<typename S, typename = typename std::enable_if<std::is_arithmetic<S>::value>::type>
+        Mvec operator^(const S &value) &&;
 
         /// \brief defines the outer product between a scalar and a multivector
         /// \param value - a scalar
@@ -262,6 +388,36 @@ namespace c2ga{
         /// \param mv2 - a primal form of a multivector; the object multivector will be dualized during the wedge with the calling multivector.
         /// \return a multivector.
         Mvec<T> outerDualDual(const Mvec<T> &mv2) const;
+
+        /// \brief defines the meet (regressive product) between two multivectors, i.e. !((!mv1)^(!mv2)), computed with explicit per-grade kernels instead of three duals and an outer product.
+        /// \param mv2 - a multivector
+        /// \return the meet of the calling multivector and mv2, e.g. the intersection of two circles or of a line and a circle.
+        Mvec<T> meet(const Mvec<T> &mv2) const;
+
+        /// \brief same as operator|, but the null k-vectors of the result are not removed after each grade block. In tight loops, call roundZero() once at the end of the computation instead (roundZero(0) only removes the exactly null k-vectors).
+        /// \param mv2 - a multivector
+        /// \return this . mv2, possibly with null k-vectors
+        Mvec<T> innerUnpruned(const Mvec<T> &mv2) const;
+
+        /// \brief same as operator<, without the per grade zero pruning (see innerUnpruned)
+        /// \param mv2 - a multivector
+        /// \return this < mv2, possibly with null k-vectors
+        Mvec<T> leftContractionUnpruned(const Mvec<T> &mv2) const;
+
+        /// \brief same as operator>, without the per grade zero pruning (see innerUnpruned)
+        /// \param mv2 - a multivector
+        /// \return this > mv2, possibly with null k-vectors
+        Mvec<T> rightContractionUnpruned(const Mvec<T> &mv2) const;
+
+        /// \brief same as operator*, without the per grade zero pruning (see innerUnpruned)
+        /// \param mv2 - a multivector
+        /// \return this * mv2, possibly with null k-vectors
+        Mvec<T> geometricUnpruned(const Mvec<T> &mv2) const;
+
+        /// \brief same as meet, without the per grade zero pruning (see innerUnpruned)
+        /// \param mv2 - a multivector
+        /// \return the meet of this and mv2, possibly with null k-vectors
+        Mvec<T> meetUnpruned(const Mvec<T> &mv2) const;
     
         
 
@@ -270,6 +426,13 @@ namespace c2ga{
         /// \return a scalar
         Mvec<T> scalarProduct(const Mvec<T> &mv2) const;
 
+        /// \brief defines the grade "grade" part of the geometric product between two multivectors: only the products of k-vectors that contribute to this grade are computed, and only for this grade
+        /// \tparam grade - the grade of the result
+        /// \param mv2 - a multivector
+        /// \return the grade "grade" part of this * mv2
+        template<unsigned int grade>
+        Mvec<T> gradeProduct(const Mvec<T> &mv2) const;
+
         /// \brief defines the Hestenes product between two multivectors (Inner product - scalar product)
         /// \param mv2 - a multivector
         /// \return a multivector.
@@ -279,7 +442,13 @@ namespace c2ga{
         /// \param value - a scalar
         /// \return mv2*value
         template<typename S>
-        Mvec operator*(const S &value) const;
+        Mvec operator*(const S &value) const &;
+
+        /// \brief defines the geometric product between an expiring multivector and a scalar, reusing its storage (only arithmetic scalars, so that an expiring Mvec operand selects the multivector product)
+        /// \param value - a scalar
+        /// \return this*value
+        template<typename S, typename = typename std::enable_if<std::is_arithmetic<S>::value>::type>
+        Mvec operator*(const S &value) &&;
 
         /// \brief defines the geometric product between a scalar and a multivector
         /// \param value - a scalar
@@ -293,6 +462,12 @@ namespace c2ga{
         /// \return this *= mv
         Mvec& operator*=(const Mvec& mv);
 
+        /// \brief scale this multivector in place, corresponds to this *= value
+        /// \param value - a scalar
+        /// \return this *= value
+        template<typename S, typename = typename std::enable_if<std::is_arithmetic<S>::value>::type>
+        Mvec& operator*=(const S &value);
+
         /// \brief defines the geometric product with a multivector and the inverse of a second multivector
         /// \param mv2 - a multivector
         /// \return this / mv2
@@ -302,7 +477,13 @@ namespace c2ga{
         /// \param value - a scalar
         /// \return this / value
         template<typename S>
-        Mvec operator/(const S &value) const;
+        Mvec operator/(const S &value) const &;
+
+        /// \brief defines the scalar inverse between an expiring multivector and a scalar, reusing its storage (only arithmetic scalars, so that an expiring Mvec operand selects the multivector product)
+        /// \param value - a scalar
+        /// \return this / value
+        template<typename S, typename = typename std::enable_if<std::is_arithmetic<S>::value>::type>
+        Mvec operator/(const S &value) &&;
 
         /// \brief defines the inverse product between a scalar and a multivector
         /// \param value - a scalar
@@ -316,6 +497,12 @@ namespace c2ga{
         /// \return this /= mv
         Mvec& operator/=(const Mvec& mv);
 
+        /// \brief divide this multivector by a scalar in place, corresponds to this /= value
+        /// \param value - a scalar
+        /// \return this /= value
+        template<typename S, typename = typename std::enable_if<std::is_arithmetic<S>::value>::type>
+        Mvec& operator/=(const S &value);
+
         /// \brief the reverse of a multivector, i.e. if mv = a1^a2^...^an, then reverse(mv) = an^...^a2^a1
         /// \param mv - a multivector
         /// \return reverse of mv
@@ -391,7 +578,7 @@ namespace c2ga{
                         return it->vec[idxHomogeneous];
 
                     // if grade exceed, create it and inster it before the current element
-                    Kvec<T> kvec = {Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(binomialArray[grade]),grade};
+                    Kvec<T> kvec = {KvecStorage<T>::Zero(binomialArray[grade]),grade};
                     auto it2 = mvData.insert(it,kvec);
                     gradeBitmap |= 1 << (grade);
                     return it2->vec[idxHomogeneous];
@@ -399,7 +586,7 @@ namespace c2ga{
             }
 
             // if the searched element should be added at the end, add it
-            Kvec<T> kvec = {Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(binomialArray[grade]),grade};
+            Kvec<T> kvec = {KvecStorage<T>::Zero(binomialArray[grade]),grade};
 
             auto it2 = mvData.insert(mvData.end(),kvec);
             gradeBitmap |= 1 << (grade);
@@ -456,7 +643,7 @@ namespace c2ga{
             if(mvData.count(gd)>0)
                 return (mvData.at(gd))(idx);
 
-            mvData[gd] = Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(Binomial<algebraDimension,gd>::value);
+            mvData[gd] = KvecStorage<T>::Zero(Binomial<algebraDimension,gd>::value);
 
             return mvData[gd](idx);
         }
@@ -469,7 +656,7 @@ namespace c2ga{
         /// \param index : index of the parameter in the k-vector (k = grade)
         inline Mvec componentToOne(const unsigned int grade, const int index){
             Kvec<T> kvec;
-			kvec.vec=Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(binomialArray[grade]);
+			kvec.vec=KvecStorage<T>::Zero(binomialArray[grade]);
 			kvec.grade=grade;
             kvec.vec[index] = T(1);
             Mvec mv1;
@@ -484,7 +671,7 @@ namespace c2ga{
         /// \brief create a VectorXd if it has not yet been created
         /// \param grade - grade of the considered kvector
         /// \return nothing
-        inline typename std::list<Kvec<T>>::iterator createVectorXdIfDoesNotExist(const unsigned int grade){
+        inline typename KvecArray<T>::iterator createVectorXdIfDoesNotExist(const unsigned int grade){
 
             auto it = mvData.begin();
             while(it != mvData.end()){
@@ -500,7 +687,7 @@ namespace c2ga{
 
                     // if grade exceed, create it and inster it before the current element
                     Kvec<T> kvec;
-					kvec.vec=Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(binomialArray[grade]);
+					kvec.vec=KvecStorage<T>::Zero(binomialArray[grade]);
 					kvec.grade=grade;
                     auto it2 = mvData.insert(it,kvec);
                     gradeBitmap |= 1 << (grade);
@@ -510,7 +697,7 @@ namespace c2ga{
 
             // if the searched element should be added at the end, add it
             Kvec<T> kvec;
-			kvec.vec=Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(binomialArray[grade]);
+			kvec.vec=KvecStorage<T>::Zero(binomialArray[grade]);
 			kvec.grade=grade;
             auto it2 = mvData.insert(mvData.end(),kvec);
             gradeBitmap |= 1 << (grade);
@@ -566,7 +753,7 @@ namespace c2ga{
 
         /// \brief search in the multivector for a Kvec of grade "grade"
         /// \return return a const iterator on the Kvec if exist, else return mvData.end()
-        inline typename std::list<Kvec<T>>::const_iterator findGrade(const unsigned int & gradeToFind) const {
+        inline typename KvecArray<T>::const_iterator findGrade(const unsigned int & gradeToFind) const {
             for(auto it = mvData.begin();it != mvData.end();++it){
                 if(it->grade==gradeToFind){
                     return it;
@@ -577,7 +764,7 @@ namespace c2ga{
 
         /// \brief search in the multivector for a Kvec of grade "grade"
         /// \return return an iterator on the Kvec if exist, else return mvData.end()
-        inline typename std::list<Kvec<T>>::iterator findGrade(const unsigned int & gradeToFind) {
+        inline typename KvecArray<T>::iterator findGrade(const unsigned int & gradeToFind) {
             for(auto it = mvData.begin();it != mvData.end();++it){
                 if(it->grade==gradeToFind){
                     return it;
@@ -608,6 +795,12 @@ namespace c2ga{
             return ( (gradeBitmap & (1<<grade)) != 0 );
         }
 
+        /// \brief return the grades of the multivector as a bitmap (bit k is set when the grade k part is present)
+        /// \return the bitmap of the grades of the multivector
+        inline unsigned int getGradeBitmap() const {
+            return gradeBitmap;
+        }
+
         /// \brief partially or completely erase the content of a multivector
         /// \param grade : if < 0, erase all the multivector, else just erase the part of grade "grade".
         void clear(const int grade = -1);
@@ -646,7 +839,13 @@ namespace c2ga{
         /// \param gradeMV - the considered grade
         /// \param moreThanOne - true if it the first element to display (should we put a '+' before)
         template<typename U>
-        friend void traverseKVector(std::ostream &stream, const Eigen::Matrix<U, Eigen::Dynamic, 1>, unsigned int gradeMV, bool& moreThanOne);
+        friend void traverseKVector(std::ostream &stream, const KvecStorage<U>, unsigned int gradeMV, bool& moreThanOne);
+        /// \endcond // do not comment this functions
+
+        /// \cond DEV
+        /// \brief product with a basis vector known at compile time, see BasisVector.hpp
+        template<const int (&table)[4][5][6], unsigned int index, bool outer, typename U>
+        friend Mvec<U> basisVectorProduct(const Mvec<U>& mv);
         /// \endcond // do not comment this functions
 
 /*
@@ -666,7 +865,7 @@ namespace c2ga{
             const int idx = (Binomial<algebraDimension,gd>::value-1) - computeIdxFromList(algebraDimension,gd,listIndices...);
 
             Mvec res;
-            res.mvData[gd] = Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(Binomial<algebraDimension,gd>::value);
+            res.mvData[gd] = KvecStorage<T>::Zero(Binomial<algebraDimension,gd>::value);
             res.mvData[gd](idx) = mvData[gd](idx);
 
             return res;
@@ -710,6 +909,35 @@ namespace c2ga{
         Mvec e12i() const {return this->extractOneComponent(3,4, 3);}
         Mvec e012i() const {return this->extractOneComponent(4,1, 0);}
 
+    protected:
+        /// \cond DEV
+        /// \brief the three flavours of inner products
+        enum InnerProductKind { innerKind, leftContractionKind, rightContractionKind };
+
+        /// \brief inner product loop shared by operator|, operator< and operator>
+        /// \tparam pruneZeros - remove the null k-vectors of the result after each grade block
+        template<bool pruneZeros>
+        Mvec innerProduct(const Mvec &mv2, const InnerProductKind kind) const;
+
+        /// \brief geometric product loop shared by operator* and geometricUnpruned
+        /// \tparam pruneZeros - remove the null k-vectors of the result after each grade block
+        template<bool pruneZeros>
+        Mvec geometricProduct(const Mvec &mv2) const;
+
+        /// \brief meet loop shared by meet and meetUnpruned
+        /// \tparam pruneZeros - remove the null k-vectors of the result after each grade block
+        template<bool pruneZeros>
+        Mvec meetProduct(const Mvec &mv2) const;
+
+        /// \brief remove the k-vector itMv if all its coefficients are null
+        /// \param itMv - iterator on a k-vector of this multivector
+        inline void eraseIfNull(typename KvecArray<T>::iterator itMv){
+            if(!((itMv->vec.array() != 0.0).any())){
+                gradeBitmap &= ~(1<<itMv->grade);
+                mvData.erase(itMv);
+            }
+        }
+        /// \endcond
 
     };  // end of the class definition
 
@@ -744,7 +972,7 @@ namespace c2ga{
         for(auto it=mv.mvData.begin(); it != mv.mvData.end(); ++it){
             Kvec<T> kvec;
             kvec.grade = it->grade;
-            kvec.vec = Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(binomialArray[it->grade]);
+            kvec.vec = KvecStorage<T>::Zero(binomialArray[it->grade]);
             for(unsigned int i=0; i<it->vec.size(); ++i)
                 kvec.vec.coeffRef(i) = T(it->vec.coeff(i));
             mvData.push_back(kvec);
@@ -753,12 +981,12 @@ namespace c2ga{
 
 
     template<typename T>
-    template<typename U>
-    Mvec<T>::Mvec(const U val) {
+    template<typename U, typename>
+    Mvec<T>::Mvec(const U val) : gradeBitmap(0) {
         if(val != U(0)) {
             gradeBitmap = 1;
             Kvec<T> kvec;
-            kvec.vec =Eigen::Matrix<T, Eigen::Dynamic, 1>(1);
+            kvec.vec =KvecStorage<T>(1);
             kvec.grade =0;
             mvData.push_back(kvec);
             mvData.begin()->vec.coeffRef(0) = val;
@@ -789,16 +1017,34 @@ namespace c2ga{
 
 
     template<typename T>
-    Mvec<T> Mvec<T>::operator+(const Mvec<T> &mv2) const {
+    Mvec<T> Mvec<T>::operator+(const Mvec<T> &mv2) const & {
         Mvec<T> mv3(*this);
-        for(auto & itMv : mv2.mvData) {
-            auto it = mv3.createVectorXdIfDoesNotExist(itMv.grade);
-            it->vec += itMv.vec;
-        }
+        mv3 += mv2;
         return mv3;
     }
 
 
+    template<typename T>
+    Mvec<T> Mvec<T>::operator+(const Mvec<T> &mv2) && {
+        *this += mv2;
+        return std::move(*this);
+    }
+
+
+    template<typename T>
+    Mvec<T> Mvec<T>::operator+(Mvec<T> &&mv2) && {
+        *this += mv2;
+        return std::move(*this);
+    }
+
+
+    template<typename U>
+    Mvec<U> operator+(const Mvec<U> &mv1, Mvec<U> &&mv2){
+        mv2 += mv1;
+        return std::move(mv2);
+    }
+
+
     template<typename U, typename S>
     Mvec<U> operator+(const S &value, const Mvec<U> &mv){
         return mv + value;
@@ -807,19 +1053,29 @@ namespace c2ga{
 
     template<typename T>
     template<typename S>
-    Mvec<T> Mvec<T>::operator+(const S &value) const {
-        Mvec<T> mv(*this);
+    Mvec<T> Mvec<T>::operator+(const S &value) const & {
+        return Mvec<T>(*this) + value;
+    }
+
+
+    template<typename T>
+    template<typename S, typename>
+    Mvec<T> Mvec<T>::operator+(const S &value) && {
         if(value != T(0)) {
-            auto it = mv.createVectorXdIfDoesNotExist(0);
+            auto it = createVectorXdIfDoesNotExist(0);
             it->vec.coeffRef(0) += value;
         }
-        return mv;
+        return std::move(*this);
     }
 
 
     template<typename T>
     Mvec<T>& Mvec<T>::operator+=(const Mvec& mv){
-        *this = *this + mv;
+        // mv may be *this: its grades already exist, so no k-vector is inserted while iterating
+        for(const auto & itMv : mv.mvData) {
+            auto it = createVectorXdIfDoesNotExist(itMv.grade);
+            it->vec += itMv.vec;
+        }
         return *this;
     }
 
@@ -833,20 +1089,49 @@ namespace c2ga{
     }
 
 
+    template<typename U>
+    Mvec<U> operator-(Mvec<U> &&mv) { // unary -
+        for(auto & itMv : mv.mvData)
+            itMv.vec = -itMv.vec;
+        return std::move(mv);
+    }
+
+
     template<typename T>
-    Mvec<T> Mvec<T>::operator-(const Mvec<T> &mv2) const {
+    Mvec<T> Mvec<T>::operator-(const Mvec<T> &mv2) const & {
         Mvec<T> mv3(*this);
-        for(auto & itMv : mv2.mvData) {
-            auto it = mv3.createVectorXdIfDoesNotExist(itMv.grade);
-            it->vec -= itMv.vec;
-        }
+        mv3 -= mv2;
         return mv3;
     }
 
 
+    template<typename T>
+    Mvec<T> Mvec<T>::operator-(const Mvec<T> &mv2) && {
+        *this -= mv2;
+        return std::move(*this);
+    }
+
+
+    template<typename T>
+    Mvec<T> Mvec<T>::operator-(Mvec<T> &&mv2) && {
+        *this -= mv2;
+        return std::move(*this);
+    }
+
+
+    template<typename U>
+    Mvec<U> operator-(const Mvec<U> &mv1, Mvec<U> &&mv2){
+        return (-std::move(mv2)) + mv1;
+    }
+
+
     template<typename T>
     Mvec<T>& Mvec<T>::operator-=(const Mvec& mv){
-        *this = *this - mv;
+        // mv may be *this: its grades already exist, so no k-vector is inserted while iterating
+        for(const auto & itMv : mv.mvData) {
+            auto it = createVectorXdIfDoesNotExist(itMv.grade);
+            it->vec -= itMv.vec;
+        }
         return *this;
     }
 
@@ -859,13 +1144,19 @@ namespace c2ga{
 
     template<typename T>
     template<typename S>
-    Mvec<T> Mvec<T>::operator-(const S &value) const {
-        Mvec<T> mv(*this);
+    Mvec<T> Mvec<T>::operator-(const S &value) const & {
+        return Mvec<T>(*this) - value;
+    }
+
+
+    template<typename T>
+    template<typename S, typename>
+    Mvec<T> Mvec<T>::operator-(const S &value) && {
         if(value != T(0)) {
-            auto it = mv.createVectorXdIfDoesNotExist(0);
+            auto it = createVectorXdIfDoesNotExist(0);
             it->vec.coeffRef(0) -= value;
         }
-        return mv;
+        return std::move(*this);
     }
 
 
@@ -887,15 +1178,15 @@ namespace c2ga{
                 }
             }
         return mv3;
-#else // use the adaptative pointer function array
+#else // use the explicit per grade functions
         // Loop over non-empty grade of mv1 and mv2
-        // call the right explicit unrolled outer function using the functions pointer called outerFunctionsContainer
+        // call the right explicit unrolled outer function using the switch of outerDispatch
         Mvec<T> mv3;
         for(const auto & itMv1 : this->mvData)
             for(const auto & itMv2 : mv2.mvData){
                 if(itMv1.grade + itMv2.grade <= (int) algebraDimension ){
                     auto itMv3 = mv3.createVectorXdIfDoesNotExist(itMv1.grade + itMv2.grade);
-                    outerFunctionsContainer<T>[itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
+                    outerDispatch<T>(itMv1.grade, itMv2.grade, itMv1.vec, itMv2.vec, itMv3->vec);
                 }
             }
         return mv3;
@@ -910,11 +1201,15 @@ namespace c2ga{
 
     template<typename T>
     template<typename S>
-    Mvec<T> Mvec<T>::operator^(const S &value) const {
-        Mvec<T> mv2(*this);
-        for(auto & itMv : mv2.mvData)
-            itMv.vec *= T(value);
-        return mv2;
+    Mvec<T> Mvec<T>::operator^(const S &value) const & {
+        return Mvec<T>(*this) * value;
+    }
+
+
+    template<typename T>
+    template<typename S, typename>
+    Mvec<T> Mvec<T>::operator^(const S &value) && {
+        return std::move(*this) * value;
     }
 
 
@@ -926,28 +1221,43 @@ namespace c2ga{
 
 
     template<typename T>
-    Mvec<T> Mvec<T>::operator|(const Mvec<T> &mv2) const{
+    template<bool pruneZeros>
+    Mvec<T> Mvec<T>::innerProduct(const Mvec<T> &mv2, const InnerProductKind kind) const{
         // Loop over non-empty grade of mv1 and mv2
-        // call the right explicit unrolled inner function using the functions pointer called innerFunctionsContainer
+        // call the right explicit unrolled inner function using the switch of innerDispatch
         Mvec<T> mv3;
         for(const auto & itMv1 : this->mvData)
             for(const auto & itMv2 : mv2.mvData){
 
+                // left contraction constraint: gradeMv1 <= gradeMv2, right contraction constraint: gradeMv1 >= gradeMv2
+                if((kind == leftContractionKind && itMv1.grade > itMv2.grade) || (kind == rightContractionKind && itMv1.grade < itMv2.grade))
+                    continue;
+
                 // perform the inner product
                 int absGradeMv3 = std::abs((int)(itMv1.grade - itMv2.grade));
                 auto itMv3 = mv3.createVectorXdIfDoesNotExist(absGradeMv3);
-                innerFunctionsContainer<T>[itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
+                innerDispatch<T>(itMv1.grade, itMv2.grade, itMv1.vec, itMv2.vec, itMv3->vec);
 
                 // check if the result is non-zero
-                if(!((itMv3->vec.array() != 0.0).any())){
-                    mv3.mvData.erase(itMv3);
-                    mv3.gradeBitmap &= ~(1<<absGradeMv3);
-                }
+                if(pruneZeros)
+                    mv3.eraseIfNull(itMv3);
             }
         return mv3;
     }
 
 
+    template<typename T>
+    Mvec<T> Mvec<T>::operator|(const Mvec<T> &mv2) const{
+        return innerProduct<true>(mv2, innerKind);
+    }
+
+
+    template<typename T>
+    Mvec<T> Mvec<T>::innerUnpruned(const Mvec<T> &mv2) const{
+        return innerProduct<false>(mv2, innerKind);
+    }
+
+
     template<typename U, typename S>
     Mvec<U> operator|(const S &value, const Mvec<U> &mv) {
         return mv | value;
@@ -970,29 +1280,13 @@ namespace c2ga{
 
     template<typename T>
     Mvec<T> Mvec<T>::operator>(const Mvec<T> &mv2) const{
-        // Loop over non-empty grade of mv1 and mv2
-        // call the right explicit unrolled inner function using the functions pointer called innerFunctionsContainer
-        Mvec<T> mv3;
-        for(const auto & itMv1 : this->mvData)
-            for(const auto & itMv2 : mv2.mvData){
-
-                // right contraction constraint: gradeMv1 >= gradeMv2
-                if(itMv1.grade < itMv2.grade)
-                    continue;
-
-                // perform the inner product
-                int absGradeMv3 = std::abs((int)(itMv1.grade - itMv2.grade));
-                auto itMv3 = mv3.createVectorXdIfDoesNotExist(absGradeMv3);
-                innerFunctionsContainer<T>[itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
+        return innerProduct<true>(mv2, rightContractionKind);
+    }
 
-                // check if the result is non-zero
-                if(!((itMv3->vec.array() != 0.0).any())){
-                    mv3.mvData.erase(itMv3);
-                    mv3.gradeBitmap &= ~(1<<absGradeMv3);
-                }
-            }
 
-        return mv3;
+    template<typename T>
+    Mvec<T> Mvec<T>::rightContractionUnpruned(const Mvec<T> &mv2) const{
+        return innerProduct<false>(mv2, rightContractionKind);
     }
 
 
@@ -1016,29 +1310,13 @@ namespace c2ga{
 
     template<typename T>
     Mvec<T> Mvec<T>::operator<(const Mvec<T> &mv2) const{
+        return innerProduct<true>(mv2, leftContractionKind);
+    }
 
-        // Loop over non-empty grade of mv1 and mv2
-        // call the right explicit unrolled inner function using the functions pointer called innerFunctionsContainer
-        Mvec<T> mv3;
-        for(const auto & itMv1 : this->mvData)
-            for(const auto & itMv2 : mv2.mvData){
-
-                // left contraction constraint: gradeMv1 <= gradeMv2
-                if(itMv1.grade > itMv2.grade)
-                    continue;
-
-                // perform the inner product
-                int absGradeMv3 = std::abs((int)(itMv1.grade - itMv2.grade));
-                auto itMv3 = mv3.createVectorXdIfDoesNotExist(absGradeMv3);
-                innerFunctionsContainer<T>[itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
 
-                // check if the result is non-zero
-                if(!((itMv3->vec.array() != 0.0).any())){
-                    mv3.mvData.erase(itMv3);
-                    mv3.gradeBitmap &= ~(1<<absGradeMv3);
-                }
-            }
-        return mv3;
+    template<typename T>
+    Mvec<T> Mvec<T>::leftContractionUnpruned(const Mvec<T> &mv2) const{
+        return innerProduct<false>(mv2, leftContractionKind);
     }
 
 
@@ -1063,7 +1341,7 @@ namespace c2ga{
     template<typename T>
     Mvec<T> Mvec<T>::scalarProduct(const Mvec<T> &mv2) const{
         // Loop over non-empty grade of mv1 and mv2
-        // call the right explicit unrolled inner function using the functions pointer called innerFunctionsContainer
+        // call the right explicit unrolled inner function using the switch of innerDispatch
         Mvec<T> mv3;
         for(const auto & itMv1 : this->mvData)
             for(const auto & itMv2 : mv2.mvData){
@@ -1074,7 +1352,7 @@ namespace c2ga{
                 // perform the inner product
                 int absGradeMv3 = 0;
                 auto itMv3 = mv3.createVectorXdIfDoesNotExist(absGradeMv3);
-                innerFunctionsContainer<T>[itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
+                innerDispatch<T>(itMv1.grade, itMv2.grade, itMv1.vec, itMv2.vec, itMv3->vec);
 
                 // check if the result is non-zero
                 if(!((itMv3->vec.array() != 0.0).any())){
@@ -1087,6 +1365,36 @@ namespace c2ga{
 
 
 
+    template<typename T>
+    template<unsigned int grade>
+    Mvec<T> Mvec<T>::gradeProduct(const Mvec<T> &mv2) const{
+        static_assert(grade <= algebraDimension, "the grade of a product is at most the dimension of the algebra");
+        Mvec<T> mv3;
+        for(const auto & itMv1 : this->mvData)
+            for(const auto & itMv2 : mv2.mvData){
+
+                // the product of k-vectors of grades g1 and g2 has the grades |g1-g2|, |g1-g2|+2, ..., min(g1+g2, 2*dimension-(g1+g2))
+                const unsigned int gradeOuter = itMv1.grade + itMv2.grade;
+                const unsigned int gradeInner = (unsigned int)std::abs((int)(itMv1.grade-itMv2.grade));
+                if(grade < gradeInner || grade > gradeOuter || grade + gradeOuter > 2*algebraDimension || (grade - gradeInner) % 2)
+                    continue;
+
+                auto itMv3 = mv3.createVectorXdIfDoesNotExist(grade);
+                if(grade == gradeOuter)
+                    outerDispatch<T>(itMv1.grade, itMv2.grade, itMv1.vec, itMv2.vec, itMv3->vec);
+                else if(grade == gradeInner)
+                    innerDispatch<T>(itMv1.grade, itMv2.grade, itMv1.vec, itMv2.vec, itMv3->vec);
+                else
+                    geometricDispatch<T>(grade, itMv1.grade, itMv2.grade, itMv1.vec, itMv2.vec, itMv3->vec);
+            }
+
+        // check if the result is non-zero
+        if(!mv3.mvData.empty())
+            mv3.eraseIfNull(mv3.mvData.begin());
+        return mv3;
+    }
+
+
     template<typename T>
     Mvec<T> Mvec<T>::outerPrimalDual(const Mvec<T> &mv2) const{
         Mvec<T> mv3;
@@ -1168,10 +1476,47 @@ namespace c2ga{
 
 
 
+    template<typename T>
+    template<bool pruneZeros>
+    Mvec<T> Mvec<T>::meetProduct(const Mvec<T> &mv2) const{
+        // Loop over non-empty grade of mv1 and mv2
+        // call the right explicit unrolled meet function using the switch of meetDispatch
+        Mvec<T> mv3;
+        for(const auto & itMv1 : this->mvData)
+            for(const auto & itMv2 : mv2.mvData){
+
+                // the meet of k-vectors whose grades sum to less than the dimension is null
+                if(itMv1.grade + itMv2.grade < algebraDimension)
+                    continue;
+
+                unsigned int grade_mv3 = itMv1.grade + itMv2.grade - algebraDimension;
+                auto itMv3 = mv3.createVectorXdIfDoesNotExist(grade_mv3);
+                meetDispatch<T>(itMv1.grade, itMv2.grade, itMv1.vec, itMv2.vec, itMv3->vec);
+
+                // check if the result is non-zero
+                if(pruneZeros)
+                    mv3.eraseIfNull(itMv3);
+            }
+        return mv3;
+    }
+
+
+    template<typename T>
+    Mvec<T> Mvec<T>::meet(const Mvec<T> &mv2) const{
+        return meetProduct<true>(mv2);
+    }
+
+
+    template<typename T>
+    Mvec<T> Mvec<T>::meetUnpruned(const Mvec<T> &mv2) const{
+        return meetProduct<false>(mv2);
+    }
+
+
     template<typename T>
     Mvec<T> Mvec<T>::hestenesProduct(const Mvec<T> &mv2) const{
         // Loop over non-empty grade of mv1 and mv2
-        // call the right explicit unrolled inner function using the functions pointer called innerFunctionsContainer
+        // call the right explicit unrolled inner function using the switch of innerDispatch
         Mvec<T> mv3;
         for(const auto & itMv1 : this->mvData)
             for(const auto & itMv2 : mv2.mvData){
@@ -1182,7 +1527,7 @@ namespace c2ga{
                 // perform the inner product
                 int absGradeMv3 = std::abs((int)(itMv1.grade - itMv2.grade));
                 auto itMv3 = mv3.createVectorXdIfDoesNotExist(absGradeMv3);
-                innerFunctionsContainer<T>[itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
+                innerDispatch<T>(itMv1.grade, itMv2.grade, itMv1.vec, itMv2.vec, itMv3->vec);
 
                 // check if the result is non-zero
                 if(!((itMv3->vec.array() != 0.0).any())){
@@ -1195,9 +1540,10 @@ namespace c2ga{
 
 
     template<typename T>
-    Mvec<T> Mvec<T>::operator*(const Mvec<T> &mv2) const {
+    template<bool pruneZeros>
+    Mvec<T> Mvec<T>::geometricProduct(const Mvec<T> &mv2) const {
         // Loop over non-empty grade of mv1 and mv2
-        // call the right explicit unrolled product function using the functions pointer
+        // call the right explicit unrolled product functions using the switches of outerDispatch, innerDispatch and geometricDispatch
         Mvec<T> mv3;
         for(const auto & itMv1 : this->mvData)
             for(const auto & itMv2 : mv2.mvData){
@@ -1206,11 +1552,9 @@ namespace c2ga{
                 unsigned int gradeOuter = itMv1.grade + itMv2.grade;
                 if(gradeOuter <=  algebraDimension ){
                     auto itMv3 = mv3.createVectorXdIfDoesNotExist(gradeOuter);
-                    outerFunctionsContainer<T>[itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
-                    if(!((itMv3->vec.array() != 0.0).any())){
-                        mv3.mvData.erase(itMv3);
-                        mv3.gradeBitmap &= ~(1<<gradeOuter);
-                    }
+                    outerDispatch<T>(itMv1.grade, itMv2.grade, itMv1.vec, itMv2.vec, itMv3->vec);
+                    if(pruneZeros)
+                        mv3.eraseIfNull(itMv3);
                 }
 
                 // inner product block
@@ -1218,23 +1562,19 @@ namespace c2ga{
                 // when the grade of one of the kvectors is zero, the inner product is the same as the outer product
                 if(gradeInner != gradeOuter) {
                     auto itMv3 = mv3.createVectorXdIfDoesNotExist(gradeInner);
-                    innerFunctionsContainer<T>[itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
+                    innerDispatch<T>(itMv1.grade, itMv2.grade, itMv1.vec, itMv2.vec, itMv3->vec);
                     // check if the result is non-zero
-                    if(!((itMv3->vec.array() != 0.0).any())){
-                        mv3.mvData.erase(itMv3);
-                        mv3.gradeBitmap &= ~(1<<gradeInner);
-                    }
+                    if(pruneZeros)
+                        mv3.eraseIfNull(itMv3);
 
                     // geometric product part
                     int gradeMax = std::min(((2*algebraDimension)-gradeOuter)+1,gradeOuter);
                     for (int gradeResult = gradeInner+2; gradeResult < gradeMax; gradeResult+=2) {
                         auto itMv3 = mv3.createVectorXdIfDoesNotExist(gradeResult);
-                        geometricFunctionsContainer<T>[gradeResult][itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
+                        geometricDispatch<T>(gradeResult, itMv1.grade, itMv2.grade, itMv1.vec, itMv2.vec, itMv3->vec);
                         // check if the result is non-zero
-                        if(!((itMv3->vec.array() != 0.0).any())){
-                            mv3.mvData.erase(itMv3);
-                            mv3.gradeBitmap &= ~(1<<gradeResult);
-                        }
+                        if(pruneZeros)
+                            mv3.eraseIfNull(itMv3);
                     }
                 }
             }
@@ -1242,6 +1582,18 @@ namespace c2ga{
     }
 
 
+    template<typename T>
+    Mvec<T> Mvec<T>::operator*(const Mvec<T> &mv2) const {
+        return geometricProduct<true>(mv2);
+    }
+
+
+    template<typename T>
+    Mvec<T> Mvec<T>::geometricUnpruned(const Mvec<T> &mv2) const {
+        return geometricProduct<false>(mv2);
+    }
+
+
     template<typename U, typename S>
     Mvec<U> operator*(const S &value, const Mvec<U> &mv){
         return mv * value;
@@ -1250,11 +1602,17 @@ namespace c2ga{
 
     template<typename T>
     template<typename S>
-    Mvec<T> Mvec<T>::operator*(const S &value) const{
-        Mvec<T> mv(*this);
-        for(auto & itMv : mv.mvData)
+    Mvec<T> Mvec<T>::operator*(const S &value) const & {
+        return Mvec<T>(*this) * value;
+    }
+
+
+    template<typename T>
+    template<typename S, typename>
+    Mvec<T> Mvec<T>::operator*(const S &value) && {
+        for(auto & itMv : mvData)
             itMv.vec *= T(value);
-        return mv;
+        return std::move(*this);
     }
 
 
@@ -1265,6 +1623,15 @@ namespace c2ga{
     }
 
 
+    template<typename T>
+    template<typename S, typename>
+    Mvec<T> &Mvec<T>::operator*=(const S &value) {
+        for(auto & itMv : mvData)
+            itMv.vec *= T(value);
+        return *this;
+    }
+
+
     template<typename T>
     Mvec<T> Mvec<T>::operator/(const Mvec<T> &mv2) const {
         return *this * mv2.inv();
@@ -1279,11 +1646,17 @@ namespace c2ga{
 
     template<typename T>
     template<typename S>
-    Mvec<T> Mvec<T>::operator/(const S &value) const {
-        Mvec<T> mv(*this);
-        for(auto & itMv : mv.mvData)
+    Mvec<T> Mvec<T>::operator/(const S &value) const & {
+        return Mvec<T>(*this) / value;
+    }
+
+
+    template<typename T>
+    template<typename S, typename>
+    Mvec<T> Mvec<T>::operator/(const S &value) && {
+        for(auto & itMv : mvData)
             itMv.vec /= value;
-        return mv;
+        return std::move(*this);
     }
 
 
@@ -1294,6 +1667,15 @@ namespace c2ga{
     }
 
 
+    template<typename T>
+    template<typename S, typename>
+    Mvec<T> &Mvec<T>::operator/=(const S &value) {
+        for(auto & itMv : mvData)
+            itMv.vec /= value;
+        return *this;
+    }
+
+
     template<typename T>
     Mvec<T> operator~(const Mvec<T> &mv){
         return mv.reverse();
@@ -1361,15 +1743,11 @@ namespace c2ga{
         // for each k-vectors of the multivector
         for(auto itMv=mvData.rbegin(); itMv!=mvData.rend(); ++itMv){
 
-            // create the dual k-vector
-            Kvec<T> kvec ={itMv->vec,algebraDimension-(itMv->grade)};
-
-            // some elements need to be permuted
-            for(unsigned int i=0;i<binomialArray[itMv->grade];++i)
-                kvec.vec.coeffRef(dualPermutations[itMv->grade][i]) = itMv->vec.coeff(i);
-
-            // the inner product may involve some constant multiplucation for the dual elements
-            kvec.vec = kvec.vec.cwiseProduct(dualCoefficients[itMv->grade].template cast<T>());
+            // create the dual k-vector: permuted and sign flipped components, see dualDispatch
+            Kvec<T> kvec;
+            kvec.grade = algebraDimension-(itMv->grade);
+            kvec.vec.resize(binomialArray[kvec.grade]);
+            dualDispatch<T>(itMv->grade, itMv->vec, kvec.vec);
 
             // add the k-vector to the resulting multivector
             mvResult.mvData.push_back(kvec);
@@ -1426,14 +1804,12 @@ namespace c2ga{
         // loop over each k-vector of the multivector
         auto itMv=mvData.begin();
         while(itMv != mvData.end()){
-            // loop over each element of the k-vector
-            for(unsigned int i=0; i<(unsigned int)itMv->vec.size(); ++i)
-                if(fabs(itMv->vec.coeff(i)) <= epsilon)
-                    itMv->vec.coeffRef(i) = 0.0;
+            // set to 0 the elements of the k-vector that are smaller than epsilon
+            itMv->vec = (itMv->vec.array().abs() <= epsilon).select(T(0), itMv->vec);
             // if the k-vector is full of 0, remove it
             if(!((itMv->vec.array() != 0.0).any())){
                 gradeBitmap = gradeBitmap - (1 << itMv->grade);
-                mvData.erase(itMv++);
+                itMv = mvData.erase(itMv);
             }
             else ++itMv;
         }
@@ -1474,7 +1850,7 @@ namespace c2ga{
 
     /// \cond DEV
     template<typename U>
-    void traverseKVector(std::ostream &stream, const Eigen::Matrix<U, Eigen::Dynamic, 1> kvector, unsigned int gradeMV, bool& moreThanOne ){
+    void traverseKVector(std::ostream &stream, const KvecStorage<U> kvector, unsigned int gradeMV, bool& moreThanOne ){
 
         // version with XOR indices
         // for the current grade, generate all the XOR indices
@@ -0,0 +1,270 @@
+// Copyright (c) 2018 by University Paris-Est Marne-la-Vallee
+// MvecBatch.hpp
+// This file is part of the Garamon for c2ga.
+// Authors: Stephane Breuils and Vincent Nozick
+// Contact: vincent.nozick@u-pem.fr
+//
+// Licence MIT
+// A a copy of the MIT License is given along with this program
+
+/// \file MvecBatch.hpp
+/// \author Stephane Breuils, Vincent Nozick
+/// \brief Batch of N multivectors stored as a structure of arrays, to apply the same sequence of operations to many multivectors (e.g. one per pixel) with vectorized kernels.
+
+
+#ifndef C2GA_MULTI_VECTOR_BATCH_HPP__
+#define C2GA_MULTI_VECTOR_BATCH_HPP__
+#pragma once
+
+#include <tuple>
+#include <Eigen/Core>
+
+#include "c2ga/Mvec.hpp"
+#include "c2ga/Constants.hpp"
+#include "c2ga/BatchExplicit.hpp"
+
+
+/*!
+ * @namespace c2ga
+ */
+namespace c2ga {
+
+    /// \class MvecBatch
+    /// \brief class defining a batch of N multivectors. Each basis blade has its own contiguous array of N coefficients (see KvecBatch), so the products are computed for the N multivectors at once with SIMD instructions (SSE2 by default, AVX/AVX-512 when compiled with -mavx2 / -mavx512f or -march=native).
+    /// Like Mvec, only the grades used by at least one multivector of the batch are stored and processed.
+    /// The size of a batch is bounded by Eigen's stack allocation limit (a few hundred multivectors), large sets are processed as several batches.
+    /// \tparam T - the type of value that we manipulate, either float or double or something else.
+    /// \tparam N - the number of multivectors of the batch, preferably a multiple of the SIMD width.
+    template<typename T, int N>
+    class MvecBatch {
+
+    protected:
+        KvecBatchTuple<T,N> mvData; /*!< one KvecBatch per grade, only the grades flagged in gradeBitmap are meaningful */
+        unsigned int gradeBitmap;   /*!< ith bit to 1 if grade i is contained in the batch */
+
+    public:
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+        /// \brief Default constructor, generate a batch of N empty multivectors.
+        MvecBatch() : gradeBitmap(0) {}
+
+        /// \brief Constructor of a batch where all the multivectors are equal to mv.
+        /// \param mv - the multivector to replicate
+        explicit MvecBatch(const Mvec<T> &mv) : gradeBitmap(0) {
+            setGrade<0>(mv); setGrade<1>(mv); setGrade<2>(mv); setGrade<3>(mv); setGrade<4>(mv);
+        }
+
+        /// \brief number of multivectors of the batch
+        static constexpr int size() { return N; }
+
+        /// \brief set the multivector at the index "index" of the batch
+        /// \param index - the index of the multivector in the batch
+        /// \param mv - the multivector
+        void set(const int index, const Mvec<T> &mv) {
+            setGrade<0>(index, mv); setGrade<1>(index, mv); setGrade<2>(index, mv); setGrade<3>(index, mv); setGrade<4>(index, mv);
+        }
+
+        /// \brief get the multivector at the index "index" of the batch
+        /// \param index - the index of the multivector in the batch
+        /// \return the multivector, without its null grades
+        Mvec<T> get(const int index) const {
+            Mvec<T> mv;
+            getGrade<0>(index, mv); getGrade<1>(index, mv); getGrade<2>(index, mv); getGrade<3>(index, mv); getGrade<4>(index, mv);
+            return mv;
+        }
+
+        /// \brief access to the grade "grade" part of the batch, it is created (set to zero) if it does not exist.
+        /// \return the KvecBatch of grade "grade"
+        template<unsigned int grade>
+        inline KvecBatch<T,N,grade>& kvec() {
+            if(!isGrade(grade)){
+                std::get<grade>(mvData).setZero();
+                gradeBitmap |= 1 << grade;
+            }
+            return std::get<grade>(mvData);
+        }
+
+        /// \brief read access to the grade "grade" part of the batch, only meaningful if isGrade(grade).
+        /// \return the KvecBatch of grade "grade"
+        template<unsigned int grade>
+        inline const KvecBatch<T,N,grade>& kvec() const {
+            return std::get<grade>(mvData);
+        }
+
+        /// \brief tell whether the batch has grade component
+        /// \param grade - grade of the considered kvector
+        /// \return true if at least one multivector of the batch may have a grade component
+        inline bool isGrade(const unsigned int grade) const {
+            return (gradeBitmap & (1 << grade)) != 0;
+        }
+
+        /// \brief return the grades of the batch as a bitmap (bit k is set when the grade k part is present)
+        inline unsigned int getGradeBitmap() const {
+            return gradeBitmap;
+        }
+
+        /// \brief erase the content of the batch
+        inline void clear() {
+            gradeBitmap = 0;
+        }
+
+        /// \brief defines the outer product between two batches, multivector by multivector
+        /// \param mv2 - second operand of type MvecBatch
+        /// \return this ^ mv2
+        MvecBatch operator^(const MvecBatch &mv2) const {
+            return product<outerBatchDispatch<T,N>>(mv2, outerBatchGrades);
+        }
+
+        /// \brief defines the inner product between two batches, multivector by multivector
+        /// \param mv2 - second operand of type MvecBatch
+        /// \return this . mv2
+        MvecBatch operator|(const MvecBatch &mv2) const {
+            return product<innerBatchDispatch<T,N>>(mv2, innerBatchGrades);
+        }
+
+        /// \brief defines the geometric product between two batches, multivector by multivector
+        /// \param mv2 - second operand of type MvecBatch
+        /// \return this * mv2
+        MvecBatch operator*(const MvecBatch &mv2) const {
+            return product<geometricBatchDispatch<T,N>>(mv2, geometricBatchGrades);
+        }
+
+        /// \brief defines the addition between two batches
+        /// \param mv2 - second operand of type MvecBatch
+        /// \return this + mv2
+        MvecBatch operator+(const MvecBatch &mv2) const {
+            MvecBatch mv3(*this);
+            mv3.template addGrade<0>(mv2, T(1)); mv3.template addGrade<1>(mv2, T(1)); mv3.template addGrade<2>(mv2, T(1)); mv3.template addGrade<3>(mv2, T(1)); mv3.template addGrade<4>(mv2, T(1));
+            return mv3;
+        }
+
+        /// \brief defines the difference between two batches
+        /// \param mv2 - second operand of type MvecBatch
+        /// \return this - mv2
+        MvecBatch operator-(const MvecBatch &mv2) const {
+            MvecBatch mv3(*this);
+            mv3.template addGrade<0>(mv2, T(-1)); mv3.template addGrade<1>(mv2, T(-1)); mv3.template addGrade<2>(mv2, T(-1)); mv3.template addGrade<3>(mv2, T(-1)); mv3.template addGrade<4>(mv2, T(-1));
+            return mv3;
+        }
+
+        /// \brief defines the product between a batch and a scalar
+        /// \param value - the scalar
+        /// \return this * value
+        MvecBatch operator*(const T &value) const {
+            MvecBatch mv3(*this);
+            std::get<0>(mv3.mvData) *= value; std::get<1>(mv3.mvData) *= value; std::get<2>(mv3.mvData) *= value; std::get<3>(mv3.mvData) *= value; std::get<4>(mv3.mvData) *= value;
+            return mv3;
+        }
+
+        /// \brief defines the opposite of a batch
+        /// \return -this
+        MvecBatch operator-() const {
+            return (*this) * T(-1);
+        }
+
+        /// \brief compute the dual of each multivector of the batch, see Mvec::dual()
+        /// \return the batch of the duals
+        MvecBatch dual() const {
+            MvecBatch mv3;
+            mv3.template dualGrade<0>(*this); mv3.template dualGrade<1>(*this); mv3.template dualGrade<2>(*this); mv3.template dualGrade<3>(*this); mv3.template dualGrade<4>(*this);
+            return mv3;
+        }
+
+        /// \brief compute the reverse of each multivector of the batch, see Mvec::reverse()
+        /// \return the batch of the reverses
+        MvecBatch reverse() const {
+            MvecBatch mv3(*this);
+            // signReversePerGrade = {1,1,-1,-1,1}
+            std::get<2>(mv3.mvData) *= T(-1);
+            std::get<3>(mv3.mvData) *= T(-1);
+            return mv3;
+        }
+
+        /// \brief dual of a batch
+        friend MvecBatch operator!(const MvecBatch &mv) { return mv.dual(); }
+
+        /// \brief reverse of a batch
+        friend MvecBatch operator~(const MvecBatch &mv) { return mv.reverse(); }
+
+        /// \brief product between a scalar and a batch
+        friend MvecBatch operator*(const T &value, const MvecBatch &mv) { return mv * value; }
+
+    private:
+        typedef void (*BatchDispatchFunction)(const unsigned int, const unsigned int, const KvecBatchTuple<T,N>&, const KvecBatchTuple<T,N>&, KvecBatchTuple<T,N>&);
+
+        /// \brief loop over the non-empty grades of both operands, the result grades are set to zero before the dispatched kernels accumulate in them.
+        template<BatchDispatchFunction dispatch>
+        MvecBatch product(const MvecBatch &mv2, const unsigned int (&resultGrades)[5][5]) const {
+            MvecBatch mv3;
+            for(unsigned int grade1=0; grade1<=algebraDimension; ++grade1){
+                if(!isGrade(grade1)) continue;
+                for(unsigned int grade2=0; grade2<=algebraDimension; ++grade2){
+                    if(!mv2.isGrade(grade2)) continue;
+                    mv3.createGrades(resultGrades[grade1][grade2]);
+                    dispatch(grade1, grade2, mvData, mv2.mvData, mv3.mvData);
+                }
+            }
+            return mv3;
+        }
+
+        /// \brief create (set to zero) the grades of the bitmap that do not exist yet
+        inline void createGrades(const unsigned int bitmap) {
+            if(bitmap & 1)  kvec<0>();
+            if(bitmap & 2)  kvec<1>();
+            if(bitmap & 4)  kvec<2>();
+            if(bitmap & 8)  kvec<3>();
+            if(bitmap & 16) kvec<4>();
+        }
+
+        template<unsigned int grade>
+        inline void addGrade(const MvecBatch &mv2, const T sign) {
+            if(mv2.isGrade(grade))
+                kvec<grade>() += sign * mv2.template kvec<grade>();
+        }
+
+        template<unsigned int grade>
+        inline void dualGrade(const MvecBatch &mv) {
+            if(!mv.isGrade(grade)) return;
+            const KvecBatch<T,N,grade> &source = mv.template kvec<grade>();
+            KvecBatch<T,N,algebraDimension-grade> &target = kvec<algebraDimension-grade>();
+            for(unsigned int i=0; i<binomialArray[grade]; ++i){
+                const unsigned int j = dualPermutations[grade][i];
+                target.col(j) = T(dualCoefficients[grade][j]) * source.col(i);
+            }
+        }
+
+        template<unsigned int grade>
+        inline void setGrade(const Mvec<T> &mv) {
+            if(mv.isEmpty() || !mv.isGrade(grade)) return;
+            KvecBatch<T,N,grade> &target = kvec<grade>();
+            const KvecStorage<T> &source = mv.findGrade(grade)->vec;
+            for(unsigned int i=0; i<binomialArray[grade]; ++i)
+                target.col(i).setConstant(source.coeff(i));
+        }
+
+        template<unsigned int grade>
+        inline void setGrade(const int index, const Mvec<T> &mv) {
+            if(mv.isEmpty() || !mv.isGrade(grade)){
+                if(isGrade(grade))
+                    std::get<grade>(mvData).row(index).setZero();
+                return;
+            }
+            KvecBatch<T,N,grade> &target = kvec<grade>();
+            const KvecStorage<T> &source = mv.findGrade(grade)->vec;
+            for(unsigned int i=0; i<binomialArray[grade]; ++i)
+                target.coeffRef(index, i) = source.coeff(i);
+        }
+
+        template<unsigned int grade>
+        inline void getGrade(const int index, Mvec<T> &mv) const {
+            if(!isGrade(grade)) return;
+            const KvecBatch<T,N,grade> &source = kvec<grade>();
+            if(!(source.row(index) != T(0)).any()) return;
+            for(unsigned int i=0; i<binomialArray[grade]; ++i)
+                mv.at(grade, i) = source.coeff(index, i);
+        }
+    };
+
+}/// End of Namespace
+
+#endif // C2GA_MULTI_VECTOR_BATCH_HPP__
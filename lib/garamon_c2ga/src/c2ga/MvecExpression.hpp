@@ -0,0 +1,584 @@
+// Copyright (c) 2018 by University Paris-Est Marne-la-Vallee
+// MvecExpression.hpp
+// This file is part of the Garamon for c2ga.
+// Authors: Stephane Breuils and Vincent Nozick
+// Conctat: vincent.nozick@u-pem.fr
+//
+// Licence MIT
+// A a copy of the MIT License is given along with this program
+
+/// \file MvecExpression.hpp
+/// \author Stephane Breuils, Vincent Nozick
+/// \brief Expression templates over c2ga::Mvec: a whole expression (e.g. p1 ^ p2 ^ ei or !((!mv1) ^ (!mv2))) is built as a light tree of nodes and is evaluated in a single pass, grade by grade, into the resulting multivector, without any intermediate Mvec.
+
+
+#ifndef C2GA_MULTI_VECTOR_EXPRESSION_HPP__
+#define C2GA_MULTI_VECTOR_EXPRESSION_HPP__
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdlib>
+#include <type_traits>
+#include <utility>
+
+#include "c2ga/Mvec.hpp"
+#include "c2ga/Constants.hpp"
+#include "c2ga/OuterExplicit.hpp"
+#include "c2ga/InnerExplicit.hpp"
+#include "c2ga/GeometricExplicit.hpp"
+#include "c2ga/DualExplicit.hpp"
+#include "c2ga/MeetExplicit.hpp"
+
+
+/*!
+ * @namespace c2ga
+ */
+namespace c2ga {
+
+    template<typename Derived, typename T> class MvecExpression;
+
+    /// \brief evaluate an expression into a new multivector. Each grade of the result is computed once, directly from the operands of the expression, and the null grades are pruned like the Mvec products do.
+    /// \param expression - the expression to evaluate
+    /// \return the multivector corresponding to the expression
+    template<typename Derived, typename T>
+    Mvec<T> evaluate(const MvecExpression<Derived,T> &expression);
+
+
+    /// \class MvecExpression
+    /// \brief base class (CRTP) of the expression nodes. Each node provides:
+    ///   - grades(): a bitmap of the grades that its result may contain (bit k for grade k),
+    ///   - addGrade(grade, kvec): accumulate the part of grade "grade" of its result in kvec.
+    /// Only the grades requested by the parent node are computed, so e.g. the scalar part of a product does not compute the other grades.
+    /// Note that a node whose result is non-homogeneous and is used for several grades by its parent is evaluated once per requested grade.
+    /// \tparam Derived - the type of the node
+    /// \tparam T - the type of value that we manipulate, either float or double or something else.
+    template<typename Derived, typename T>
+    class MvecExpression {
+    public:
+        typedef T value_type;
+
+        /// \brief access to the actual node
+        inline const Derived& derived() const { return static_cast<const Derived&>(*this); }
+
+        /// \brief evaluate the part of grade "grade" of the node
+        /// \param grade - the grade to evaluate
+        /// \param tmp - a k-vector that can be used as storage for the result
+        /// \return a reference on the k-vector of grade "grade", either tmp or a k-vector owned by the node
+        inline const KvecStorage<T>& evalGrade(const unsigned int grade, KvecStorage<T>& tmp) const {
+            tmp = KvecStorage<T>::Zero(binomialArray[grade]);
+            derived().addGrade(grade, tmp);
+            return tmp;
+        }
+
+        /// \brief evaluate the expression into a multivector
+        inline operator Mvec<T>() const { return evaluate(*this); }
+    };
+
+
+    /// \brief trait telling whether a type is an expression node
+    template<typename E>
+    struct isMvecExpression {
+    private:
+        template<typename D, typename T>
+        static std::true_type test(const MvecExpression<D,T>*);
+        static std::false_type test(...);
+    public:
+        static constexpr bool value = decltype(test(std::declval<typename std::decay<E>::type*>()))::value;
+    };
+
+
+    /// \class MvecLeaf
+    /// \brief leaf of an expression: a multivector, either referenced (Storage = const Mvec<T>&) or owned (Storage = Mvec<T>, used for the temporaries like ei<T>()).
+    template<typename T, typename Storage = const Mvec<T>&>
+    class MvecLeaf : public MvecExpression<MvecLeaf<T,Storage>, T> {
+    public:
+        explicit MvecLeaf(const Mvec<T> &mv) : mv(mv), gradeBitmap(this->mv.getGradeBitmap()) {}
+        explicit MvecLeaf(Mvec<T> &&mv) : mv(std::move(mv)), gradeBitmap(this->mv.getGradeBitmap()) {}
+
+        inline unsigned int grades() const { return gradeBitmap; }
+
+        inline void addGrade(const unsigned int grade, KvecStorage<T>& kvec) const {
+            if(gradeBitmap & (1 << grade))
+                kvec += mv.findGrade(grade)->vec;
+        }
+
+        /// \brief the k-vectors of a leaf are directly used by its parent, without any copy
+        inline const KvecStorage<T>& evalGrade(const unsigned int grade, KvecStorage<T>& tmp) const {
+            if(gradeBitmap & (1 << grade))
+                return mv.findGrade(grade)->vec;
+            tmp = KvecStorage<T>::Zero(binomialArray[grade]);
+            return tmp;
+        }
+
+    private:
+        Storage mv;
+        unsigned int gradeBitmap; /*!< grades of mv, computed once */
+    };
+
+
+    /// \brief outer product policy of MvecProductExpression
+    struct OuterProductPolicy {
+        static inline unsigned int resultGrades(const unsigned int grade1, const unsigned int grade2) {
+            return (grade1 + grade2 <= algebraDimension) ? 1u << (grade1 + grade2) : 0u;
+        }
+        template<typename T>
+        static inline void accumulate(const unsigned int, const unsigned int grade1, const unsigned int grade2, const KvecStorage<T>& kvec1, const KvecStorage<T>& kvec2, KvecStorage<T>& kvec3) {
+            outerDispatch<T>(grade1, grade2, kvec1, kvec2, kvec3);
+        }
+    };
+
+    /// \brief inner product policy of MvecProductExpression (same as Mvec::operator|)
+    struct InnerProductPolicy {
+        static inline unsigned int resultGrades(const unsigned int grade1, const unsigned int grade2) {
+            return 1u << std::abs((int)grade1 - (int)grade2);
+        }
+        template<typename T>
+        static inline void accumulate(const unsigned int, const unsigned int grade1, const unsigned int grade2, const KvecStorage<T>& kvec1, const KvecStorage<T>& kvec2, KvecStorage<T>& kvec3) {
+            innerDispatch<T>(grade1, grade2, kvec1, kvec2, kvec3);
+        }
+    };
+
+    /// \brief left contraction policy of MvecProductExpression (same as Mvec::operator<)
+    struct LeftContractionPolicy {
+        static inline unsigned int resultGrades(const unsigned int grade1, const unsigned int grade2) {
+            return (grade1 <= grade2) ? 1u << (grade2 - grade1) : 0u;
+        }
+        template<typename T>
+        static inline void accumulate(const unsigned int, const unsigned int grade1, const unsigned int grade2, const KvecStorage<T>& kvec1, const KvecStorage<T>& kvec2, KvecStorage<T>& kvec3) {
+            innerDispatch<T>(grade1, grade2, kvec1, kvec2, kvec3);
+        }
+    };
+
+    /// \brief right contraction policy of MvecProductExpression (same as Mvec::operator>)
+    struct RightContractionPolicy {
+        static inline unsigned int resultGrades(const unsigned int grade1, const unsigned int grade2) {
+            return (grade1 >= grade2) ? 1u << (grade1 - grade2) : 0u;
+        }
+        template<typename T>
+        static inline void accumulate(const unsigned int, const unsigned int grade1, const unsigned int grade2, const KvecStorage<T>& kvec1, const KvecStorage<T>& kvec2, KvecStorage<T>& kvec3) {
+            innerDispatch<T>(grade1, grade2, kvec1, kvec2, kvec3);
+        }
+    };
+
+    /// \brief geometric product policy of MvecProductExpression (same decomposition as Mvec::operator*: outer part, inner part and the grades in between)
+    struct GeometricProductPolicy {
+        static inline unsigned int resultGrades(const unsigned int grade1, const unsigned int grade2) {
+            unsigned int gradeOuter = grade1 + grade2;
+            unsigned int gradeInner = (unsigned int)std::abs((int)grade1 - (int)grade2);
+            unsigned int bitmap = (gradeOuter <= algebraDimension) ? 1u << gradeOuter : 0u;
+            if(gradeInner != gradeOuter) {
+                bitmap |= 1u << gradeInner;
+                int gradeMax = std::min(((2*algebraDimension)-gradeOuter)+1,gradeOuter);
+                for(int gradeResult = gradeInner+2; gradeResult < gradeMax; gradeResult+=2)
+                    bitmap |= 1u << gradeResult;
+            }
+            return bitmap;
+        }
+        template<typename T>
+        static inline void accumulate(const unsigned int grade3, const unsigned int grade1, const unsigned int grade2, const KvecStorage<T>& kvec1, const KvecStorage<T>& kvec2, KvecStorage<T>& kvec3) {
+            if(grade3 == grade1 + grade2)
+                outerDispatch<T>(grade1, grade2, kvec1, kvec2, kvec3);
+            else if(grade3 == (unsigned int)std::abs((int)grade1 - (int)grade2))
+                innerDispatch<T>(grade1, grade2, kvec1, kvec2, kvec3);
+            else
+                geometricDispatch<T>(grade3, grade1, grade2, kvec1, kvec2, kvec3);
+        }
+    };
+
+
+    /// \brief meet policy of MvecProductExpression (same as Mvec::meet)
+    struct MeetProductPolicy {
+        static inline unsigned int resultGrades(const unsigned int grade1, const unsigned int grade2) {
+            return (grade1 + grade2 >= algebraDimension) ? 1u << (grade1 + grade2 - algebraDimension) : 0u;
+        }
+        template<typename T>
+        static inline void accumulate(const unsigned int, const unsigned int grade1, const unsigned int grade2, const KvecStorage<T>& kvec1, const KvecStorage<T>& kvec2, KvecStorage<T>& kvec3) {
+            meetDispatch<T>(grade1, grade2, kvec1, kvec2, kvec3);
+        }
+    };
+
+
+    /// \class MvecProductExpression
+    /// \brief product node, the kind of product is given by the Policy (outer, inner, contractions, geometric).
+    /// For a requested grade, only the pairs of grades of the operands that contribute to this grade are evaluated.
+    template<typename Policy, typename Lhs, typename Rhs, typename T>
+    class MvecProductExpression : public MvecExpression<MvecProductExpression<Policy,Lhs,Rhs,T>, T> {
+    public:
+        MvecProductExpression(const Lhs &lhs, const Rhs &rhs) : lhs(lhs), rhs(rhs), gradeBitmap(productGrades(lhs.grades(), rhs.grades())) {}
+
+        inline unsigned int grades() const { return gradeBitmap; }
+
+        inline const Lhs& left() const { return lhs; }
+        inline const Rhs& right() const { return rhs; }
+
+        inline void addGrade(const unsigned int grade, KvecStorage<T>& kvec) const {
+            if(!(gradeBitmap & (1 << grade)))
+                return;
+            const unsigned int grades1 = lhs.grades(), grades2 = rhs.grades();
+            KvecStorage<T> tmp1, tmp2[algebraDimension+1];
+            const KvecStorage<T>* kvec2[algebraDimension+1] = {nullptr};
+            for(unsigned int grade1=0; (grades1 >> grade1) != 0; ++grade1){
+                if(!(grades1 & (1 << grade1)))
+                    continue;
+                const KvecStorage<T>* kvec1 = nullptr;
+                for(unsigned int grade2=0; (grades2 >> grade2) != 0; ++grade2){
+                    if(!(grades2 & (1 << grade2)) || !(Policy::resultGrades(grade1, grade2) & (1 << grade)))
+                        continue;
+                    // each grade of lhs and of rhs is evaluated once, however many pairs it is part of
+                    if(kvec1 == nullptr)
+                        kvec1 = &lhs.evalGrade(grade1, tmp1);
+                    if(kvec2[grade2] == nullptr)
+                        kvec2[grade2] = &rhs.evalGrade(grade2, tmp2[grade2]);
+                    Policy::template accumulate<T>(grade, grade1, grade2, *kvec1, *kvec2[grade2], kvec);
+                }
+            }
+        }
+
+    private:
+        static inline unsigned int productGrades(const unsigned int grades1, const unsigned int grades2) {
+            unsigned int bitmap = 0;
+            for(unsigned int grade1=0; (grades1 >> grade1) != 0; ++grade1)
+                if(grades1 & (1 << grade1))
+                    for(unsigned int grade2=0; (grades2 >> grade2) != 0; ++grade2)
+                        if(grades2 & (1 << grade2))
+                            bitmap |= Policy::resultGrades(grade1, grade2);
+            return bitmap;
+        }
+
+        Lhs lhs;
+        Rhs rhs;
+        unsigned int gradeBitmap; /*!< grades that the product may contain, computed once */
+    };
+
+
+    /// \class MvecDualExpression
+    /// \brief dual node, the explicit dual of each grade is applied while accumulating, see Mvec::dual()
+    template<typename E, typename T>
+    class MvecDualExpression : public MvecExpression<MvecDualExpression<E,T>, T> {
+    public:
+        explicit MvecDualExpression(const E &expression) : expression(expression), gradeBitmap(dualGrades(expression.grades())) {}
+
+        inline unsigned int grades() const { return gradeBitmap; }
+
+        inline const E& operand() const { return expression; }
+
+        inline void addGrade(const unsigned int grade, KvecStorage<T>& kvec) const {
+            if(!(gradeBitmap & (1 << grade)))
+                return;
+            const unsigned int gradeSource = algebraDimension - grade;
+            KvecStorage<T> tmp, dual(binomialArray[grade]);
+            dualDispatch<T>(gradeSource, expression.evalGrade(gradeSource, tmp), dual);
+            kvec += dual;
+        }
+
+    private:
+        static inline unsigned int dualGrades(const unsigned int grades) {
+            unsigned int bitmap = 0;
+            for(unsigned int grade=0; (grades >> grade) != 0; ++grade)
+                if(grades & (1 << grade))
+                    bitmap |= 1 << (algebraDimension - grade);
+            return bitmap;
+        }
+
+        E expression;
+        unsigned int gradeBitmap; /*!< grades of the dual, computed once */
+    };
+
+
+    /// \class MvecScaleExpression
+    /// \brief node multiplying each grade of an expression by a scalar (scalar product, opposite, difference)
+    template<typename E, typename T>
+    class MvecScaleExpression : public MvecExpression<MvecScaleExpression<E,T>, T> {
+    public:
+        MvecScaleExpression(const E &expression, const T &factor) : expression(expression), factor(factor) {}
+
+        inline unsigned int grades() const { return expression.grades(); }
+
+        inline void addGrade(const unsigned int grade, KvecStorage<T>& kvec) const {
+            KvecStorage<T> tmp;
+            kvec += factor * expression.evalGrade(grade, tmp);
+        }
+
+    private:
+        E expression;
+        T factor;
+    };
+
+
+    /// \class MvecReverseExpression
+    /// \brief reverse node, see Mvec::reverse()
+    template<typename E, typename T>
+    class MvecReverseExpression : public MvecExpression<MvecReverseExpression<E,T>, T> {
+    public:
+        explicit MvecReverseExpression(const E &expression) : expression(expression) {}
+
+        inline unsigned int grades() const { return expression.grades(); }
+
+        inline void addGrade(const unsigned int grade, KvecStorage<T>& kvec) const {
+            if(signReversePerGrade[grade] == 1)
+                expression.addGrade(grade, kvec);
+            else {
+                KvecStorage<T> tmp;
+                kvec -= expression.evalGrade(grade, tmp);
+            }
+        }
+
+    private:
+        E expression;
+    };
+
+
+    /// \class MvecSumExpression
+    /// \brief sum of two expressions
+    template<typename Lhs, typename Rhs, typename T>
+    class MvecSumExpression : public MvecExpression<MvecSumExpression<Lhs,Rhs,T>, T> {
+    public:
+        MvecSumExpression(const Lhs &lhs, const Rhs &rhs) : lhs(lhs), rhs(rhs) {}
+
+        inline unsigned int grades() const { return lhs.grades() | rhs.grades(); }
+
+        inline void addGrade(const unsigned int grade, KvecStorage<T>& kvec) const {
+            if(lhs.grades() & (1 << grade))
+                lhs.addGrade(grade, kvec);
+            if(rhs.grades() & (1 << grade))
+                rhs.addGrade(grade, kvec);
+        }
+
+    private:
+        Lhs lhs;
+        Rhs rhs;
+    };
+
+
+    /// \class MvecScalarSumExpression
+    /// \brief sum of an expression and a scalar
+    template<typename E, typename T>
+    class MvecScalarSumExpression : public MvecExpression<MvecScalarSumExpression<E,T>, T> {
+    public:
+        MvecScalarSumExpression(const E &expression, const T &value) : expression(expression), value(value) {}
+
+        inline unsigned int grades() const { return expression.grades() | 1; }
+
+        inline void addGrade(const unsigned int grade, KvecStorage<T>& kvec) const {
+            if(expression.grades() & (1 << grade))
+                expression.addGrade(grade, kvec);
+            if(grade == 0)
+                kvec.coeffRef(0) += value;
+        }
+
+    private:
+        E expression;
+        T value;
+    };
+
+
+    /// \cond DEV
+    // type of the expression node corresponding to an operand: expressions are kept as they are,
+    // lvalue Mvec are referenced and rvalue Mvec (temporaries) are moved into the leaf
+    template<typename A, typename T, bool isExpression = isMvecExpression<A>::value>
+    struct ExpressionOperand {
+        typedef typename std::decay<A>::type type;
+        static inline const type& get(const type &a) { return a; }
+    };
+
+    template<typename A, typename T>
+    struct ExpressionOperand<A, T, false> {
+        typedef typename std::conditional<std::is_lvalue_reference<A>::value, MvecLeaf<T>, MvecLeaf<T,Mvec<T>>>::type type;
+        static inline type get(A &&a) { return type(std::forward<A>(a)); }
+    };
+
+    // value type of an operand (expression or Mvec)
+    template<typename A, bool isExpression = isMvecExpression<A>::value>
+    struct OperandValueType { typedef typename std::decay<A>::type::value_type type; };
+
+    template<typename A>
+    struct OperandValueType<A, false> { typedef void type; };
+
+    template<typename U>
+    struct OperandValueType<Mvec<U>, false> { typedef U type; };
+
+    template<typename A>
+    struct OperandType : OperandValueType<typename std::decay<A>::type> {};
+
+    // enabled when one operand is an expression and the other one is an expression or a Mvec of the same value type
+    template<typename A, typename B>
+    using EnableIfExpressionOperands = typename std::enable_if<
+        (isMvecExpression<A>::value || isMvecExpression<B>::value)
+        && !std::is_void<typename OperandType<A>::type>::value
+        && std::is_same<typename OperandType<A>::type, typename OperandType<B>::type>::value,
+        typename OperandType<A>::type>::type;
+
+    template<typename Policy, typename A, typename B, typename T = EnableIfExpressionOperands<A,B>>
+    using ProductExpressionOf = MvecProductExpression<Policy, typename ExpressionOperand<A,T>::type, typename ExpressionOperand<B,T>::type, T>;
+
+    template<typename Policy, typename A, typename B, typename T = EnableIfExpressionOperands<A,B>>
+    inline ProductExpressionOf<Policy,A,B> makeProductExpression(A &&a, B &&b) {
+        return ProductExpressionOf<Policy,A,B>(ExpressionOperand<A,T>::get(std::forward<A>(a)), ExpressionOperand<B,T>::get(std::forward<B>(b)));
+    }
+    /// \endcond
+
+
+    /// \brief start an expression from a multivector, e.g. lazy(p1) ^ p2 ^ ei<double>(). The multivector is referenced, so it has to outlive the expression.
+    template<typename T>
+    inline MvecLeaf<T> lazy(const Mvec<T> &mv) {
+        return MvecLeaf<T>(mv);
+    }
+
+    /// \brief start an expression from a temporary multivector, which is moved into the expression.
+    template<typename T>
+    inline MvecLeaf<T,Mvec<T>> lazy(Mvec<T> &&mv) {
+        return MvecLeaf<T,Mvec<T>>(std::move(mv));
+    }
+
+
+    /// \brief outer product, at least one operand is an expression, the other one is an expression or a multivector
+    template<typename A, typename B, typename = EnableIfExpressionOperands<A,B>>
+    inline ProductExpressionOf<OuterProductPolicy,A,B> operator^(A &&a, B &&b) {
+        return makeProductExpression<OuterProductPolicy>(std::forward<A>(a), std::forward<B>(b));
+    }
+
+    /// \brief inner product, at least one operand is an expression, the other one is an expression or a multivector
+    template<typename A, typename B, typename = EnableIfExpressionOperands<A,B>>
+    inline ProductExpressionOf<InnerProductPolicy,A,B> operator|(A &&a, B &&b) {
+        return makeProductExpression<InnerProductPolicy>(std::forward<A>(a), std::forward<B>(b));
+    }
+
+    /// \brief left contraction, at least one operand is an expression, the other one is an expression or a multivector
+    template<typename A, typename B, typename = EnableIfExpressionOperands<A,B>>
+    inline ProductExpressionOf<LeftContractionPolicy,A,B> operator<(A &&a, B &&b) {
+        return makeProductExpression<LeftContractionPolicy>(std::forward<A>(a), std::forward<B>(b));
+    }
+
+    /// \brief right contraction, at least one operand is an expression, the other one is an expression or a multivector
+    template<typename A, typename B, typename = EnableIfExpressionOperands<A,B>>
+    inline ProductExpressionOf<RightContractionPolicy,A,B> operator>(A &&a, B &&b) {
+        return makeProductExpression<RightContractionPolicy>(std::forward<A>(a), std::forward<B>(b));
+    }
+
+    /// \brief geometric product, at least one operand is an expression, the other one is an expression or a multivector
+    template<typename A, typename B, typename = EnableIfExpressionOperands<A,B>>
+    inline ProductExpressionOf<GeometricProductPolicy,A,B> operator*(A &&a, B &&b) {
+        return makeProductExpression<GeometricProductPolicy>(std::forward<A>(a), std::forward<B>(b));
+    }
+
+    /// \brief sum, at least one operand is an expression, the other one is an expression or a multivector
+    template<typename A, typename B, typename T = EnableIfExpressionOperands<A,B>>
+    inline MvecSumExpression<typename ExpressionOperand<A,T>::type, typename ExpressionOperand<B,T>::type, T> operator+(A &&a, B &&b) {
+        return MvecSumExpression<typename ExpressionOperand<A,T>::type, typename ExpressionOperand<B,T>::type, T>(
+            ExpressionOperand<A,T>::get(std::forward<A>(a)), ExpressionOperand<B,T>::get(std::forward<B>(b)));
+    }
+
+    /// \brief difference, at least one operand is an expression, the other one is an expression or a multivector
+    template<typename A, typename B, typename T = EnableIfExpressionOperands<A,B>>
+    inline MvecSumExpression<typename ExpressionOperand<A,T>::type, MvecScaleExpression<typename ExpressionOperand<B,T>::type,T>, T> operator-(A &&a, B &&b) {
+        typedef MvecScaleExpression<typename ExpressionOperand<B,T>::type,T> Opposite;
+        return MvecSumExpression<typename ExpressionOperand<A,T>::type, Opposite, T>(
+            ExpressionOperand<A,T>::get(std::forward<A>(a)), Opposite(ExpressionOperand<B,T>::get(std::forward<B>(b)), T(-1)));
+    }
+
+    /// \brief division by a multivector or an expression, i.e. the geometric product by its inverse. The inverse is computed when the expression is built.
+    template<typename A, typename B, typename T = EnableIfExpressionOperands<A,B>>
+    inline MvecProductExpression<GeometricProductPolicy, typename ExpressionOperand<A,T>::type, MvecLeaf<T,Mvec<T>>, T> operator/(A &&a, B &&b) {
+        const Mvec<T> denominator = b;
+        return MvecProductExpression<GeometricProductPolicy, typename ExpressionOperand<A,T>::type, MvecLeaf<T,Mvec<T>>, T>(
+            ExpressionOperand<A,T>::get(std::forward<A>(a)), MvecLeaf<T,Mvec<T>>(denominator.inv()));
+    }
+
+
+    /// \brief dual of an expression, see Mvec::dual()
+    template<typename E, typename T>
+    inline MvecDualExpression<E,T> operator!(const MvecExpression<E,T> &expression) {
+        return MvecDualExpression<E,T>(expression.derived());
+    }
+
+    /// \cond DEV
+    /// \brief check on the dual tables that the dual of the dual of any basis blade is its opposite
+    constexpr bool isDoubleDualOpposite() {
+        for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+            for(unsigned int i=0; i<binomialArray[grade]; ++i){
+                const unsigned int j = dualPermutations[grade][i];
+                const unsigned int k = dualPermutations[algebraDimension-grade][j];
+                if(k != i || dualCoefficients[grade][j] * dualCoefficients[algebraDimension-grade][k] != -1.0)
+                    return false;
+            }
+        return true;
+    }
+    /// \endcond
+
+    /// \brief dual of a dual, !!mv = -mv: the two coefficient permutations are skipped, only the sign flip remains
+    template<typename E, typename T>
+    inline MvecScaleExpression<E,T> operator!(const MvecExpression<MvecDualExpression<E,T>,T> &expression) {
+        static_assert(isDoubleDualOpposite(), "the dual of a dual is not the opposite, operator! on a dual expression has to be updated");
+        return MvecScaleExpression<E,T>(expression.derived().operand(), T(-1));
+    }
+
+    /// \brief dual of the outer product of two duals, i.e. the meet !((!mv1)^(!mv2)): rewritten as a single meet product of the primal operands, see Mvec::meet()
+    template<typename Lhs, typename Rhs, typename T>
+    inline MvecProductExpression<MeetProductPolicy,Lhs,Rhs,T> operator!(const MvecExpression<MvecProductExpression<OuterProductPolicy, MvecDualExpression<Lhs,T>, MvecDualExpression<Rhs,T>, T>, T> &expression) {
+        return MvecProductExpression<MeetProductPolicy,Lhs,Rhs,T>(expression.derived().left().operand(), expression.derived().right().operand());
+    }
+
+    /// \brief reverse of an expression, see Mvec::reverse()
+    template<typename E, typename T>
+    inline MvecReverseExpression<E,T> operator~(const MvecExpression<E,T> &expression) {
+        return MvecReverseExpression<E,T>(expression.derived());
+    }
+
+    /// \brief opposite of an expression
+    template<typename E, typename T>
+    inline MvecScaleExpression<E,T> operator-(const MvecExpression<E,T> &expression) {
+        return MvecScaleExpression<E,T>(expression.derived(), T(-1));
+    }
+
+    /// \brief product of an expression and a scalar
+    template<typename E, typename T, typename S, typename = typename std::enable_if<std::is_arithmetic<S>::value>::type>
+    inline MvecScaleExpression<E,T> operator*(const MvecExpression<E,T> &expression, const S &value) {
+        return MvecScaleExpression<E,T>(expression.derived(), T(value));
+    }
+
+    /// \brief product of a scalar and an expression
+    template<typename E, typename T, typename S, typename = typename std::enable_if<std::is_arithmetic<S>::value>::type>
+    inline MvecScaleExpression<E,T> operator*(const S &value, const MvecExpression<E,T> &expression) {
+        return MvecScaleExpression<E,T>(expression.derived(), T(value));
+    }
+
+    /// \brief division of an expression by a scalar
+    template<typename E, typename T, typename S, typename = typename std::enable_if<std::is_arithmetic<S>::value>::type>
+    inline MvecScaleExpression<E,T> operator/(const MvecExpression<E,T> &expression, const S &value) {
+        return MvecScaleExpression<E,T>(expression.derived(), T(1) / T(value));
+    }
+
+    /// \brief sum of an expression and a scalar
+    template<typename E, typename T, typename S, typename = typename std::enable_if<std::is_arithmetic<S>::value>::type>
+    inline MvecScalarSumExpression<E,T> operator+(const MvecExpression<E,T> &expression, const S &value) {
+        return MvecScalarSumExpression<E,T>(expression.derived(), T(value));
+    }
+
+    /// \brief difference between an expression and a scalar
+    template<typename E, typename T, typename S, typename = typename std::enable_if<std::is_arithmetic<S>::value>::type>
+    inline MvecScalarSumExpression<E,T> operator-(const MvecExpression<E,T> &expression, const S &value) {
+        return MvecScalarSumExpression<E,T>(expression.derived(), -T(value));
+    }
+
+
+    template<typename Derived, typename T>
+    Mvec<T> evaluate(const MvecExpression<Derived,T> &expression) {
+        const Derived &node = expression.derived();
+        const unsigned int grades = node.grades();
+        Mvec<T> mv;
+        for(unsigned int grade=0; grade<=algebraDimension; ++grade){
+            if(!(grades & (1 << grade)))
+                continue;
+            // the grades are increasing, the k-vector is created at the end of the multivector
+            auto it = mv.createVectorXdIfDoesNotExist(grade);
+            node.addGrade(grade, it->vec);
+            // check if the result is non-zero
+            if(!((it->vec.array() != 0.0).any()))
+                mv.clear(grade);
+        }
+        return mv;
+    }
+
+}/// End of Namespace
+
+#endif // C2GA_MULTI_VECTOR_EXPRESSION_HPP__
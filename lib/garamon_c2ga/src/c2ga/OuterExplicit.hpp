@@ -34,7 +34,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 0
 	template<typename T>
-	void outer_0_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void outer_0_0(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(0);
 	}
 
@@ -45,7 +45,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 1
 	template<typename T>
-	void outer_0_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void outer_0_1(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3 += mv1.coeff(0)*mv2;
 	}
 
@@ -56,7 +56,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 2
 	template<typename T>
-	void outer_0_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void outer_0_2(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3 += mv1.coeff(0)*mv2;
 	}
 
@@ -67,7 +67,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 3
 	template<typename T>
-	void outer_0_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void outer_0_3(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3 += mv1.coeff(0)*mv2;
 	}
 
@@ -78,7 +78,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 4
 	template<typename T>
-	void outer_0_4(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void outer_0_4(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3 += mv1.coeff(0)*mv2;
 	}
 
@@ -89,7 +89,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 1
 	template<typename T>
-	void outer_1_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void outer_1_0(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3 += mv1*mv2.coeff(0);
 	}
 
@@ -100,7 +100,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 2
 	template<typename T>
-	void outer_1_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void outer_1_1(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(1) - mv1.coeff(1)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(2) - mv1.coeff(2)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(3)*mv2.coeff(0);
@@ -116,7 +116,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 3
 	template<typename T>
-	void outer_1_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void outer_1_2(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(1)*mv2.coeff(1) + mv1.coeff(2)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(4) - mv1.coeff(1)*mv2.coeff(2) + mv1.coeff(3)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(5) - mv1.coeff(2)*mv2.coeff(2) + mv1.coeff(3)*mv2.coeff(1);
@@ -130,7 +130,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 4
 	template<typename T>
-	void outer_1_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void outer_1_3(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(1)*mv2.coeff(2) + mv1.coeff(2)*mv2.coeff(1) - mv1.coeff(3)*mv2.coeff(0);
 	}
 
@@ -141,7 +141,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 2
 	template<typename T>
-	void outer_2_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void outer_2_0(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3 += mv1*mv2.coeff(0);
 	}
 
@@ -152,7 +152,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 3
 	template<typename T>
-	void outer_2_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void outer_2_1(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(2) - mv1.coeff(1)*mv2.coeff(1) + mv1.coeff(3)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(2)*mv2.coeff(1) + mv1.coeff(4)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(1)*mv2.coeff(3) - mv1.coeff(2)*mv2.coeff(2) + mv1.coeff(5)*mv2.coeff(0);
@@ -166,7 +166,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 4
 	template<typename T>
-	void outer_2_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void outer_2_2(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(5) - mv1.coeff(1)*mv2.coeff(4) + mv1.coeff(2)*mv2.coeff(3) + mv1.coeff(3)*mv2.coeff(2) - mv1.coeff(4)*mv2.coeff(1) + mv1.coeff(5)*mv2.coeff(0);
 	}
 
@@ -177,7 +177,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 3
 	template<typename T>
-	void outer_3_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void outer_3_0(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3 += mv1*mv2.coeff(0);
 	}
 
@@ -188,7 +188,7 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 4
 	template<typename T>
-	void outer_3_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void outer_3_1(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(1)*mv2.coeff(2) + mv1.coeff(2)*mv2.coeff(1) - mv1.coeff(3)*mv2.coeff(0);
 	}
 
@@ -199,15 +199,43 @@ namespace c2ga {
 	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 4
 	template<typename T>
-	void outer_4_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	void outer_4_0(const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
 		mv3 += mv1*mv2.coeff(0);
 	}
 
 
-	
+	/// \brief Call the explicit outer product between two homogeneous multivectors mv1 (grade gradeMv1) and mv2 (grade gradeMv2). The switch is resolved at compile time when the grades are known, else it compiles to a jump table; in both cases the kernel can be inlined.
+	/// \tparam the type of value that we manipulate, either float or double or something.
+	/// \param gradeMv1 - grade of the first k-vector
+	/// \param gradeMv2 - grade of the second k-vector
+	/// \param mv1 - the first homogeneous multivector
+	/// \param mv2 - the second homogeneous multivector
+	/// \param mv3 - the homogeneous multivector in which the result mv1^mv2 is accumulated
+	template<typename T>
+	inline void outerDispatch(const unsigned int gradeMv1, const unsigned int gradeMv2, const KvecStorage<T>& mv1, const KvecStorage<T>& mv2, KvecStorage<T>& mv3){
+		switch(gradeMv1*(algebraDimension+1) + gradeMv2){
+			case 0: outer_0_0<T>(mv1, mv2, mv3); break;
+			case 1: outer_0_1<T>(mv1, mv2, mv3); break;
+			case 2: outer_0_2<T>(mv1, mv2, mv3); break;
+			case 3: outer_0_3<T>(mv1, mv2, mv3); break;
+			case 4: outer_0_4<T>(mv1, mv2, mv3); break;
+			case 5: outer_1_0<T>(mv1, mv2, mv3); break;
+			case 6: outer_1_1<T>(mv1, mv2, mv3); break;
+			case 7: outer_1_2<T>(mv1, mv2, mv3); break;
+			case 8: outer_1_3<T>(mv1, mv2, mv3); break;
+			case 10: outer_2_0<T>(mv1, mv2, mv3); break;
+			case 11: outer_2_1<T>(mv1, mv2, mv3); break;
+			case 12: outer_2_2<T>(mv1, mv2, mv3); break;
+			case 15: outer_3_0<T>(mv1, mv2, mv3); break;
+			case 16: outer_3_1<T>(mv1, mv2, mv3); break;
+			case 20: outer_4_0<T>(mv1, mv2, mv3); break;
+			default: break;
+		}
+	}
+
 
     template<typename T>
-	std::array<std::array<std::function<void(const Eigen::Matrix<T, Eigen::Dynamic, 1> & , const Eigen::Matrix<T, Eigen::Dynamic, 1> & , Eigen::Matrix<T, Eigen::Dynamic, 1>&)>, 5>, 5> outerFunctionsContainer = {{
+	constexpr std::array<std::array<KvecProductFunction<T>, 5>, 5> outerFunctionsContainer = {{
 		{{outer_0_0<T>,outer_0_1<T>,outer_0_2<T>,outer_0_3<T>,outer_0_4<T>}},
 		{{outer_1_0<T>,outer_1_1<T>,outer_1_2<T>,outer_1_3<T>,{}}},
 		{{outer_2_0<T>,outer_2_1<T>,outer_2_2<T>,{},{}}},
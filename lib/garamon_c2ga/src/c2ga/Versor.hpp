@@ -0,0 +1,126 @@
+// Copyright (c) 2018 by University Paris-Est Marne-la-Vallee
+// Versor.hpp
+// This file is part of the Garamon for c2ga.
+// Authors: Stephane Breuils and Vincent Nozick
+// Contact: vincent.nozick@u-pem.fr
+//
+// Licence MIT
+// A a copy of the MIT License is given along with this program
+
+/// \file Versor.hpp
+/// \author Stephane Breuils, Vincent Nozick
+/// \brief Application of a versor (translator, rotor, dilator, ...) to many multivectors: the sandwich product V X V^-1 is a linear map on each grade, computed once per versor as a matrix and then applied to the multivectors with a matrix product.
+
+
+#ifndef C2GA_VERSOR_HPP__
+#define C2GA_VERSOR_HPP__
+#pragma once
+
+#include <tuple>
+#include <Eigen/Core>
+
+#include "c2ga/Mvec.hpp"
+#include "c2ga/MvecBatch.hpp"
+
+
+/*!
+ * @namespace c2ga
+ */
+namespace c2ga {
+
+    /// \brief matrix of the grade "grade" part of the sandwich product X -> V X V^-1, i.e. the i-th column is the image of the i-th basis blade of grade "grade".
+    /// \tparam grade - the grade of the multivectors to transform
+    /// \param versor - an even versor (product of an even number of vectors, e.g. a translator, a rotor or a dilator)
+    /// \return the Binomial(dimension,grade) x Binomial(dimension,grade) matrix of the transformation
+    template<unsigned int grade, typename T>
+    Eigen::Matrix<T, Binomial<algebraDimension,grade>::value, Binomial<algebraDimension,grade>::value> versorMatrix(const Mvec<T> &versor) {
+        Eigen::Matrix<T, Binomial<algebraDimension,grade>::value, Binomial<algebraDimension,grade>::value> matrix;
+        const Mvec<T> inverse = versor.inv();
+        for(unsigned int i=0; i<Binomial<algebraDimension,grade>::value; ++i){
+            Mvec<T> blade;
+            blade.at(grade, i) = T(1);
+            const Mvec<T> image = versor * blade * inverse;
+            for(unsigned int j=0; j<Binomial<algebraDimension,grade>::value; ++j)
+                matrix(j,i) = (image.getGradeBitmap() & (1 << grade)) ? image.findGrade(grade)->vec.coeff(j) : T(0);
+        }
+        return matrix;
+    }
+
+
+    /// \class VersorTransform
+    /// \brief the sandwich product X -> V X V^-1 of an even versor V, stored as one matrix per grade (see versorMatrix). The matrices are computed once, then each transformed multivector only costs a matrix-vector product per grade.
+    template<typename T>
+    class VersorTransform {
+
+    public:
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+        /// \brief compute the matrices of the sandwich product of the versor
+        /// \param versor - an even versor (e.g. a translator, a rotor, a dilator or a product of them)
+        explicit VersorTransform(const Mvec<T> &versor)
+            : matrices(versorMatrix<0>(versor), versorMatrix<1>(versor), versorMatrix<2>(versor), versorMatrix<3>(versor), versorMatrix<4>(versor)) {}
+
+        /// \brief the matrix of the grade "grade" part of the transformation
+        template<unsigned int grade>
+        inline const Eigen::Matrix<T, Binomial<algebraDimension,grade>::value, Binomial<algebraDimension,grade>::value>& matrix() const {
+            return std::get<grade>(matrices);
+        }
+
+        /// \brief transform a multivector
+        /// \param mv - the multivector
+        /// \return V mv V^-1
+        Mvec<T> operator()(const Mvec<T> &mv) const {
+            Mvec<T> mv3(mv);
+            applyGrade<0>(mv3); applyGrade<1>(mv3); applyGrade<2>(mv3); applyGrade<3>(mv3); applyGrade<4>(mv3);
+            return mv3;
+        }
+
+        /// \brief transform each multivector of a batch
+        /// \param batch - the multivectors
+        /// \return the batch of the transformed multivectors
+        template<int N>
+        MvecBatch<T,N> operator()(const MvecBatch<T,N> &batch) const {
+            MvecBatch<T,N> result;
+            applyGrade<0>(batch, result); applyGrade<1>(batch, result); applyGrade<2>(batch, result); applyGrade<3>(batch, result); applyGrade<4>(batch, result);
+            return result;
+        }
+
+    private:
+        template<unsigned int grade>
+        inline void applyGrade(Mvec<T> &mv) const {
+            if(!(mv.getGradeBitmap() & (1 << grade)))
+                return;
+            KvecStorage<T> &vec = mv.findGrade(grade)->vec;
+            vec = (matrix<grade>() * vec).eval();
+        }
+
+        template<unsigned int grade, int N>
+        inline void applyGrade(const MvecBatch<T,N> &batch, MvecBatch<T,N> &result) const {
+            if(!batch.isGrade(grade))
+                return;
+            // one column (i.e. one coefficient of the N multivectors) at a time, so that each line of the matrix is a vectorized linear combination
+            const KvecBatch<T,N,grade> &source = batch.template kvec<grade>();
+            KvecBatch<T,N,grade> &target = result.template kvec<grade>();
+            for(unsigned int j=0; j<Binomial<algebraDimension,grade>::value; ++j){
+                target.col(j) = matrix<grade>()(j,0) * source.col(0);
+                for(unsigned int i=1; i<Binomial<algebraDimension,grade>::value; ++i)
+                    target.col(j) += matrix<grade>()(j,i) * source.col(i);
+            }
+        }
+
+        std::tuple<Eigen::Matrix<T,1,1>, Eigen::Matrix<T,4,4>, Eigen::Matrix<T,6,6>, Eigen::Matrix<T,4,4>, Eigen::Matrix<T,1,1>> matrices; /*!< one matrix per grade */
+    };
+
+
+    /// \brief apply the versor to each multivector of the batch: V X V^-1. To transform several batches with the same versor, build a VersorTransform once instead.
+    /// \param versor - an even versor (e.g. a translator, a rotor or a dilator)
+    /// \param batch - the multivectors to transform
+    /// \return the batch of the transformed multivectors
+    template<typename T, int N>
+    MvecBatch<T,N> applyVersor(const Mvec<T> &versor, const MvecBatch<T,N> &batch) {
+        return VersorTransform<T>(versor)(batch);
+    }
+
+}/// End of Namespace
+
+#endif // C2GA_VERSOR_HPP__
@@ -99,4 +99,75 @@ inline void boundingSphere(const BBox3f& bbox, glm::vec3& c,
     radius = glm::length(size(bbox)) * 0.5f;
 }
 
+struct BBox2f
+{
+    static const auto dim = 2;
+    glm::vec2 lower, upper;
+
+    BBox2f           ( )                   { }
+    BBox2f           ( const BBox2f& other ) { lower = other.lower; upper = other.upper; }
+    BBox2f& operator=( const BBox2f& other ) { lower = other.lower; upper = other.upper; return *this; }
+
+    BBox2f ( const glm::vec2& v                 ) : lower(v),   upper(v) {}
+    BBox2f ( const glm::vec2& lower, const glm::vec2& upper ) : lower(lower), upper(upper) {}
+
+    void grow(const BBox2f& other) { lower = glm::min(lower,other.lower); upper = glm::max(upper,other.upper); }
+    void grow(const glm::vec2   & other) { lower = glm::min(lower,other    ); upper = glm::max(upper,other    ); }
+
+    bool empty() const { for (auto i = 0u; i < dim; i++) if (lower[i] > upper[i]) return true; return false; }
+
+    glm::vec2 size() const { return upper - lower; }
+};
+
+/*! tests if box is empty */
+inline bool isEmpty(const BBox2f& box) { return box.empty(); }
+
+/*! computes the center of the box */
+inline const glm::vec2 center (const BBox2f& box) { return .5f * (box.lower + box.upper); }
+inline const glm::vec2 center2(const BBox2f& box) { return box.lower + box.upper; }
+
+/*! computes the size of the box */
+inline const glm::vec2 size(const BBox2f& box) { return box.size(); }
+
+/*! computes half the perimeter of the box, the 2D counterpart of the surface area */
+inline float halfPerimeter(const BBox2f& box) { const glm::vec2 d = box.size(); return d.x + d.y; }
+
+/*! merges bounding boxes and points */
+inline const BBox2f merge( const BBox2f& a, const       glm::vec2& b ) { return BBox2f(glm::min(a.lower, b    ), glm::max(a.upper, b    )); }
+inline const BBox2f merge( const       glm::vec2& a, const BBox2f& b ) { return BBox2f(glm::min(a    , b.lower), glm::max(a    , b.upper)); }
+inline const BBox2f merge( const BBox2f& a, const BBox2f& b ) { return BBox2f(glm::min(a.lower, b.lower), glm::max(a.upper, b.upper)); }
+inline const BBox2f& operator+=( BBox2f& a, const BBox2f& b ) { return a = merge(a,b); }
+inline const BBox2f& operator+=( BBox2f& a, const       glm::vec2& b ) { return a = merge(a,b); }
+
+/*! Comparison Operators */
+inline bool operator==( const BBox2f& a, const BBox2f& b ) { return a.lower == b.lower && a.upper == b.upper; }
+inline bool operator!=( const BBox2f& a, const BBox2f& b ) { return a.lower != b.lower || a.upper != b.upper; }
+
+/*! intersect bounding boxes */
+inline const BBox2f intersect( const BBox2f& a, const BBox2f& b ) { return BBox2f(glm::max(a.lower, b.lower), glm::min(a.upper, b.upper)); }
+
+/*! tests if bounding boxes (and points) are conjoint (non-empty intersection) */
+inline bool conjoint( const BBox2f& a, const BBox2f& b )
+{ const glm::vec2 d = glm::min(a.upper, b.upper) - glm::max(a.lower, b.lower); for ( size_t i = 0 ; i < BBox2f::dim ; i++ ) if ( d[i] < 0.f ) return false; return true; }
+inline bool conjoint( const BBox2f& a, const  glm::vec2& b )
+{ const glm::vec2 d = glm::min(a.upper, b)       - glm::max(a.lower, b);       for ( size_t i = 0 ; i < BBox2f::dim ; i++ ) if ( d[i] < 0.f ) return false; return true; }
+
+/*! tests if the segment [a, b] and the box are conjoint: the box overlaps the bounding box of
+    the segment and its corners are not all strictly on the same side of the line (a, b) */
+inline bool conjoint( const BBox2f& box, const glm::vec2& a, const glm::vec2& b )
+{
+  if (!conjoint(box, BBox2f(glm::min(a, b), glm::max(a, b)))) return false;
+  const glm::vec2 d = b - a;
+  const float s0 = d.x * (box.lower.y - a.y) - d.y * (box.lower.x - a.x);
+  const float s1 = d.x * (box.lower.y - a.y) - d.y * (box.upper.x - a.x);
+  const float s2 = d.x * (box.upper.y - a.y) - d.y * (box.lower.x - a.x);
+  const float s3 = d.x * (box.upper.y - a.y) - d.y * (box.upper.x - a.x);
+  return !((s0 > 0.f && s1 > 0.f && s2 > 0.f && s3 > 0.f) || (s0 < 0.f && s1 < 0.f && s2 < 0.f && s3 < 0.f));
+}
+
+/*! output operator */
+inline std::ostream& operator<<(std::ostream& cout, const BBox2f& box) {
+  return cout << "[" << box.lower << "; " << box.upper << "]";
+}
+
 }
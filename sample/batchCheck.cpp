@@ -0,0 +1,130 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <c2ga/Mvec.hpp>
+#include <c2ga/MvecBatch.hpp>
+#include <c2ga/Versor.hpp>
+
+using namespace c2ga;
+
+// Check of the batch kernels of MvecBatch (BatchExplicit.hpp) against the same operations on each Mvec:
+//  - products ^ | *, sum, difference, scalar product, dual, reverse and VersorTransform on random
+//    multivectors with random grades (each multivector of a batch has its own grades)
+//  - speed of the intersection of two circles !(!a ^ !b) for a batch, compared to one Mvec at a time
+
+const int batchSize = 64;
+const int nbBatches = 64;
+const int nbRepeats = 50;
+const double tolerance = 1e-12;
+
+typedef MvecBatch<double,batchSize> Batch;
+typedef std::vector<Batch, Eigen::aligned_allocator<Batch>> Batches;
+
+std::mt19937 rng(42);
+std::uniform_real_distribution<double> uniform(-2.0, 2.0);
+
+// random multivector, with the grades of the bitmap
+Mvec<double> randomMvec(const unsigned int grades) {
+    Mvec<double> mv;
+    for(unsigned int i=0; i<16; ++i)
+        if(grades & (1 << __builtin_popcount(i)))
+            mv[i] = uniform(rng);
+    return mv;
+}
+
+// random circle of center (x,y), as the dual of the point x e1 + y e2 + 0.5(x^2+y^2-r^2) ei + e0
+Mvec<double> randomCircle() {
+    Mvec<double> dualCircle;
+    const double x = 100.0 * uniform(rng), y = 100.0 * uniform(rng), r = 10.0 + 20.0 * std::abs(uniform(rng));
+    dualCircle[E0] = 1.0;
+    dualCircle[E1] = x;
+    dualCircle[E2] = y;
+    dualCircle[Ei] = 0.5 * (x*x + y*y - r*r);
+    return !dualCircle;
+}
+
+// error relative to the largest coefficient of the reference b (circles have large ei coefficients)
+double maxError(const Mvec<double> &a, const Mvec<double> &b) {
+    double error = 0, scale = 1.0;
+    for(unsigned int i=0; i<16; ++i){
+        error = std::max(error, std::abs(a[i] - b[i]));
+        scale = std::max(scale, std::abs(b[i]));
+    }
+    return error / scale;
+}
+
+template<typename F>
+double elapsedMs(F f) {
+    auto start = std::chrono::steady_clock::now();
+    for(int k=0; k<nbRepeats; ++k)
+        f();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / nbRepeats;
+}
+
+int main(){
+
+    // correctness
+    const double angle = 0.3;
+    const Mvec<double> versor = (1.0 - 0.5 * ((2.0 * e1<double>() + 5.0 * e2<double>()) * ei<double>())) * (cos(0.5*angle) - sin(0.5*angle) * e12<double>());
+    const VersorTransform<double> transform(versor);
+    double error = 0;
+    for(int b=0; b<nbBatches; ++b){
+        std::vector<Mvec<double>> x(batchSize), y(batchSize), c(batchSize);
+        Batch batchX, batchY, batchC;
+        for(int i=0; i<batchSize; ++i){
+            x[i] = randomMvec(rng() % 32);
+            y[i] = randomMvec(rng() % 32);
+            c[i] = randomCircle();
+            batchX.set(i, x[i]);
+            batchY.set(i, y[i]);
+            batchC.set(i, c[i]);
+        }
+        const Batch outer = batchX ^ batchY, inner = batchX | batchY, geometric = batchX * batchY;
+        const Batch sum = batchX + batchY, difference = batchX - batchY, scaled = 1.5 * batchX;
+        const Batch dual = !batchX, reverse = ~batchX, transformed = transform(batchC);
+        for(int i=0; i<batchSize; ++i){
+            error = std::max(error, maxError(outer.get(i), x[i] ^ y[i]));
+            error = std::max(error, maxError(inner.get(i), x[i] | y[i]));
+            error = std::max(error, maxError(geometric.get(i), x[i] * y[i]));
+            error = std::max(error, maxError(sum.get(i), x[i] + y[i]));
+            error = std::max(error, maxError(difference.get(i), x[i] - y[i]));
+            error = std::max(error, maxError(scaled.get(i), 1.5 * x[i]));
+            error = std::max(error, maxError(dual.get(i), !x[i]));
+            error = std::max(error, maxError(reverse.get(i), ~x[i]));
+            error = std::max(error, maxError(transformed.get(i), versor * c[i] * ~versor));
+        }
+    }
+
+    // speed: intersection of circles, one batch of batchSize pairs against batchSize Mvec evaluations
+    std::vector<Mvec<double>> a(nbBatches * batchSize), b(nbBatches * batchSize), scalarResults(nbBatches * batchSize);
+    Batches batchesA(nbBatches), batchesB(nbBatches), batchResults(nbBatches);
+    for(int i=0; i<nbBatches * batchSize; ++i){
+        a[i] = randomCircle();
+        b[i] = randomCircle();
+        batchesA[i / batchSize].set(i % batchSize, a[i]);
+        batchesB[i / batchSize].set(i % batchSize, b[i]);
+    }
+    const double scalarMs = elapsedMs([&](){
+        for(unsigned int i=0; i<a.size(); ++i)
+            scalarResults[i] = !(!a[i] ^ !b[i]);
+    });
+    const double batchMs = elapsedMs([&](){
+        for(int k=0; k<nbBatches; ++k)
+            batchResults[k] = !(!batchesA[k] ^ !batchesB[k]);
+    });
+    for(unsigned int i=0; i<a.size(); ++i)
+        error = std::max(error, maxError(batchResults[i / batchSize].get(i % batchSize), scalarResults[i]));
+
+    std::cout << "intersections of " << a.size() << " pairs of circles" << std::endl;
+    std::cout << "  Mvec     : " << scalarMs << " ms" << std::endl;
+    std::cout << "  MvecBatch: " << batchMs << " ms (batches of " << batchSize << ", x" << scalarMs / batchMs << ")" << std::endl;
+    std::cout << "max relative error : " << error << std::endl;
+
+    const bool ok = error <= tolerance;
+    std::cout << (ok ? "OK" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,149 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <gar/Renderer.hpp>
+#include <gar/c2gaTools.hpp>
+
+using namespace gar;
+
+// Regression check of gar::Renderer on a fixed scene (the scene of the viewer, at half size):
+//  - progressive : render() in steps of 5% of the pixels must give exactly the image of renderAll()
+//  - threads     : renderAll() on one thread must give exactly the image on all the threads
+//  - fixed light : renderAll() with the visibility map must give exactly the image with the BVH
+//  - reference   : the image, quantized to 8 bits, must match rendererReference.pgm
+//  - tangency    : intersectLineCircle on short lines nearly tangent to a circle, from tiny to huge scenes
+// Run with --update to write the reference again after an intended change of the shading.
+
+const int width = 256;
+const int height = 256;
+
+// Pixels exactly on a circle or on a shadow edge may change with the precision (GAR_SINGLE_PRECISION)
+// or the instruction set, these few pixels are tolerated
+const int maxDifferentPixels = 32;
+
+void setupScene(Renderer &renderer) {
+    renderer.setLightSize(175.f);
+    renderer.setLightPosition(glm::vec2(45.f, 15.f));
+    renderer.addObstacle(Circle<Real>(-40, -60, 10));
+    renderer.addObstacle(Circle<Real>(-40, 25, 30));
+    renderer.addObstacle(Circle<Real>(-35, 60, 20));
+    renderer.addObstacle(Circle<Real>(60, -50, 40));
+}
+
+std::vector<unsigned char> quantize(const std::vector<glm::vec4> &pixels) {
+    std::vector<unsigned char> gray(pixels.size());
+    for (size_t i = 0; i < pixels.size(); i++)
+        gray[i] = (unsigned char)std::lround(std::min(std::max(pixels[i].x, 0.f), 1.f) * 255.f);
+    return gray;
+}
+
+// Binary PGM (P5) of width x height gray levels
+bool readPGM(const std::string &path, std::vector<unsigned char> &gray) {
+    std::ifstream file(path, std::ios::binary);
+    std::string magic;
+    int w, h, maxValue;
+    if (!(file >> magic >> w >> h >> maxValue) || magic != "P5" || w != width || h != height || maxValue != 255)
+        return false;
+    file.get();
+    gray.resize(width * height);
+    return (bool)file.read((char*)gray.data(), gray.size());
+}
+
+bool writePGM(const std::string &path, const std::vector<unsigned char> &gray) {
+    std::ofstream file(path, std::ios::binary);
+    file << "P5\n" << width << " " << height << "\n255\n";
+    return (bool)file.write((const char*)gray.data(), gray.size());
+}
+
+int countDifferences(const std::vector<glm::vec4> &a, const std::vector<glm::vec4> &b) {
+    int count = 0;
+    for (size_t i = 0; i < a.size(); i++)
+        count += a[i] != b[i];
+    return count;
+}
+
+// Largest error (relative to the radius) of the points of intersectLineCircle on a short line, parallel
+// to e1 at the distance (1 - gap) r from the center of a circle of radius r, over the scales of the scene
+double tangencyError() {
+    double error = 0;
+    for (const double scale : {1e-9, 1e-6, 1e-3, 1., 1e3, 1e6})
+        for (const double gap : {1e-1, 1e-4, 1e-8}) {
+            const double x = 10 * scale, y = -20 * scale, r = 50 * scale;
+            const double lineY = y + r * (1 - gap);
+            const Circle<double> c(x, y, r);
+            const auto inter = intersectLineCircle(line(Point<double>(x - 1e-3 * r, lineY), Point<double>(x + 1e-3 * r, lineY)), c);
+            if (!inter.intersected)
+                return INFINITY;
+            for (const auto &p : {inter.first, inter.second}) {
+                error = std::max(error, std::abs(std::hypot(p[1] - x, p[2] - y) - r) / r);
+                error = std::max(error, std::abs(p[2] - lineY) / r);
+            }
+        }
+    // A line without direction does not intersect
+    const Point<double> p(3., 4.);
+    if (intersectLineCircle(line(p, p), Circle<double>(0., 0., 5.)).intersected)
+        return INFINITY;
+    return error;
+}
+
+int main(int argc, char **argv) {
+    const std::string referencePath = GAR_RENDERER_REFERENCE;
+    bool ok = true;
+
+    const double tangency = tangencyError();
+    std::cout << "tangency: max relative error " << tangency << std::endl;
+    ok = ok && tangency < 1e-9;
+
+    for (int shadows = 0; shadows < 3; shadows++) {
+        Renderer renderer(width, height);
+        setupScene(renderer);
+        renderer.setShadows(shadows);
+
+        std::vector<glm::vec4> all(width * height), progressive(width * height), serial(width * height), fixedLight(width * height);
+        renderer.renderAll(all.data());
+        renderer.restart();
+        while (!renderer.render(progressive.data(), width * height / 20));
+        renderer.setThreads(1);
+        renderer.renderAll(serial.data());
+        renderer.setFixedLight(true);
+        renderer.renderAll(fixedLight.data());
+
+        const int progressiveDifferences = countDifferences(all, progressive);
+        const int threadsDifferences = countDifferences(all, serial);
+        const int fixedLightDifferences = countDifferences(all, fixedLight);
+        std::cout << "shadows " << shadows << std::endl;
+        std::cout << "  progressive / renderAll : " << progressiveDifferences << " different pixels" << std::endl;
+        std::cout << "  1 thread / all threads  : " << threadsDifferences << " different pixels" << std::endl;
+        std::cout << "  visibility map / BVH    : " << fixedLightDifferences << " different pixels" << std::endl;
+        ok = ok && progressiveDifferences == 0 && threadsDifferences == 0 && fixedLightDifferences == 0;
+
+        // The reference is the image with the advanced shadows, the default of the viewer
+        if (shadows != 2)
+            continue;
+        const std::vector<unsigned char> gray = quantize(all);
+        if (argc > 1 && std::string(argv[1]) == "--update") {
+            if (!writePGM(referencePath, gray)) {
+                std::cerr << "cannot write " << referencePath << std::endl;
+                return 1;
+            }
+            std::cout << "  reference written to " << referencePath << std::endl;
+            continue;
+        }
+        std::vector<unsigned char> reference;
+        if (!readPGM(referencePath, reference)) {
+            std::cerr << "cannot read " << referencePath << std::endl;
+            return 1;
+        }
+        int referenceDifferences = 0;
+        for (size_t i = 0; i < gray.size(); i++)
+            referenceDifferences += std::abs((int)gray[i] - (int)reference[i]) > 1;
+        std::cout << "  reference               : " << referenceDifferences << " different pixels (tolerance " << maxDifferentPixels << ")" << std::endl;
+        ok = ok && referenceDifferences <= maxDifferentPixels;
+    }
+
+    std::cout << (ok ? "OK" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
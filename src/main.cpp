@@ -28,6 +28,8 @@
 #include <gar/c2gaTools.hpp>
 #include <gar/drawing.hpp>
 #include <gar/Light.hpp>
+#include <gar/Blades.hpp>
+#include <gar/Renderer.hpp>
 
 using namespace c2ga;
 using namespace gar;
@@ -67,13 +69,6 @@ glm::mat3 rotate(float a) {
 	return glm::mat3(glm::vec3(cos(a), sin(a), 0), glm::vec3(-sin(a), cos(a), 0), glm::vec3(0, 0, 1));
 }
 
-void resetCanvas(std::vector<glm::vec4> &pixelsColors, int &offsetStart, int& offsetEnd, const int &nbPixelsToDraw, bool &drawn) {
-	std::fill(pixelsColors.begin(), pixelsColors.end(), glm::vec4(0., 0., 0., 1.));
-	offsetStart = 0;
-	offsetEnd = nbPixelsToDraw;
-	drawn = false;
-}
-
 int main(int argc, char** argv) {
 	std::cout << "Lancement du programme..." << std::endl;
 
@@ -107,19 +102,7 @@ int main(int argc, char** argv) {
 	float lightIntensityMult = 1.5f;
 
 	// Texture
-	std::vector<glm::vec4> pixelsColors(WIDTH * HEIGHT);
-	std::vector<glm::ivec2> pixelsPositions(WIDTH * HEIGHT);
-
-	for (int i = 0; i < WIDTH; i++) {
-		for (int j = 0; j < HEIGHT; j++) {
-			pixelsColors[(i * WIDTH) + j] = glm::vec4(0., 0., 0., 0.); // RGBA
-			pixelsPositions[(i * WIDTH) + j] = glm::ivec2(i, j); // x, y
-		}
-	}
-
-	// Randomize pixel positions
-	auto rng = std::default_random_engine {};
-	std::shuffle(std::begin(pixelsPositions), std::end(pixelsPositions), rng);
+	std::vector<glm::vec4> pixelsColors(WIDTH * HEIGHT, glm::vec4(0., 0., 0., 0.)); // RGBA
 
 	GLuint texture;
 	glGenTextures(1, &texture);
@@ -177,24 +160,16 @@ int main(int argc, char** argv) {
 	// VAO unbind
 	glBindVertexArray(0);
 
-	// Light Setup
-	Light mainLight(350.f, 512.f, glm::vec2(90.f, 30.f));
-	float ambientIntensity = 0.1f;
-	float inObstacleColor = 0.01f;
-
-	Mvec<double> lightPosition = point(90.0, 30.0);
+	// Renderer and light setup
+	Renderer renderer(WIDTH, HEIGHT);
+	renderer.setLightSize(350.f);
+	renderer.setLightPosition(glm::vec2(90.f, 30.f));
 
 	// Add obstacles
-	Mvec<double> circle1 = circle(-80, -120, 20);
-	Mvec<double> circle2 = circle(-80, 50, 60);
-	Mvec<double> circle3 = circle(-70, 120, 40);
-	Mvec<double> circle4 = circle(120, -100, 80);
-
-	std::vector<Mvec<double>> obstacles;
-	obstacles.push_back(circle1);
-	obstacles.push_back(circle2);
-	obstacles.push_back(circle3);
-	obstacles.push_back(circle4);
+	renderer.addObstacle(Circle<Real>(-80, -120, 20));
+	renderer.addObstacle(Circle<Real>(-80, 50, 60));
+	renderer.addObstacle(Circle<Real>(-70, 120, 40));
+	renderer.addObstacle(Circle<Real>(120, -100, 80));
 
 	// Init Chronometer
 	auto lastTime = std::chrono::system_clock::now();
@@ -203,16 +178,6 @@ int main(int argc, char** argv) {
 	// Iterative drawing
 	int nbPixelsTotal = WIDTH * HEIGHT;
 	int nbPixelsToDraw = nbPixelsTotal * .05; // We draw only 5% of the image at each draw loop until the all image is processed
-	int offsetStart = 0;
-	int offsetEnd = nbPixelsToDraw;
-	bool drawn = false;
-
-	// Init pixel informations
-	float intensity = 0.f;
-	bool isIntersected = false;
-	bool isInCircle = false;
-	float distanceFromLight;
-	int showShadows = 2; // 0: No shadows, 1: Basic shadows, 2: Advanced shadows
 
 	// Application loop:
 	bool done = false;
@@ -233,34 +198,29 @@ int main(int argc, char** argv) {
 							done = true;
 							break;
 						case SDLK_KP_PLUS:
-							mainLight.size() += 25.f;
-							mainLight.size() = std::min(mainLight.size(), mainLight.maxSize());
-							resetCanvas(pixelsColors, offsetStart, offsetEnd, nbPixelsToDraw, drawn);
+							renderer.setLightSize(renderer.light().size() + 25.f);
 							break;
 						case SDLK_KP_MINUS:
-							mainLight.size() -= 25.f;
-							mainLight.size() = std::max(mainLight.size(), 0.f);
-							resetCanvas(pixelsColors, offsetStart, offsetEnd, nbPixelsToDraw, drawn);
+							renderer.setLightSize(renderer.light().size() - 25.f);
 							break;
 						case SDLK_UP:
 							lightIntensityMult += .5f;
 							lightIntensityMult = std::min(lightIntensityMult, 4.f);
-							resetCanvas(pixelsColors, offsetStart, offsetEnd, nbPixelsToDraw, drawn);
+							renderer.restart();
 							break;
 						case SDLK_DOWN:
 							lightIntensityMult -= .5f;
 							lightIntensityMult = std::max(lightIntensityMult, 0.f);
-							resetCanvas(pixelsColors, offsetStart, offsetEnd, nbPixelsToDraw, drawn);
+							renderer.restart();
 							break;
 						case SDLK_s:
-							showShadows = (showShadows + 1) % 3;
-							if (showShadows == 0)
+							renderer.setShadows((renderer.shadows() + 1) % 3);
+							if (renderer.shadows() == 0)
 								std::cout << "No shadows" << std::endl;
-							if (showShadows == 1)
+							if (renderer.shadows() == 1)
 								std::cout << "Basic shadows" << std::endl;
-							if (showShadows == 2)
+							if (renderer.shadows() == 2)
 								std::cout << "Advanced shadows" << std::endl;
-							resetCanvas(pixelsColors, offsetStart, offsetEnd, nbPixelsToDraw, drawn);
 							break;
 						default:
 							break;
@@ -268,11 +228,8 @@ int main(int argc, char** argv) {
 					break;
 				case SDL_MOUSEMOTION:
 					if (windowManager.isMouseButtonPressed(SDL_BUTTON_LEFT)) {
-						mainLight.pos() += glm::vec2(e.motion.xrel, -e.motion.yrel);
-						lightPosition = point(mainLight.pos().x, mainLight.pos().y);
-						// Reset pixels to black
-						resetCanvas(pixelsColors, offsetStart, offsetEnd, nbPixelsToDraw, drawn);
-						// std::shuffle(std::begin(pixelsPositions), std::end(pixelsPositions), rng);
+						// Move the light, the image starts again from black pixels
+						renderer.setLightPosition(renderer.light().pos() + glm::vec2(e.motion.xrel, -e.motion.yrel));
 						break;
 					}
 				default:
@@ -286,114 +243,9 @@ int main(int argc, char** argv) {
 
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-		// Init pixel informations
-		intensity = 0.f;
-		isIntersected = false;
-		isInCircle = false;
-		distanceFromLight;
-
 		// Compute pixels
-		if (!drawn) {
-			// Shuffle pixelsPositions
-			if (offsetStart == 0)
-				std::shuffle(std::begin(pixelsPositions), std::end(pixelsPositions), rng);
-
-			if (offsetStart <= WIDTH * HEIGHT) {
-				for (int i = offsetStart; i <= offsetEnd; i++) {
-					// Compute pixel color
-					auto coordX = pixelsPositions[i].x;
-					auto coordY = pixelsPositions[i].y;
-					auto idx = coordX * WIDTH + coordY;
-					auto closeToCircle = false;
-					auto distanceFromBackPoint = 0.f;
-					auto lessDistanceFromBackPoint = 0.f;
-
-					// Get the multivector (point) from X and Y coords of the pixel
-					auto currentPixel = point((double)coordY - WIDTH * .5, -(double)coordX + HEIGHT * .5);
-
-					// Get the distance between the pixel and the light source
-					distanceFromLight = distance(point(mainLight.pos()), currentPixel);
-					if (distanceFromLight > mainLight.size()) {
-						// The pixel is too far from the light source
-						intensity = ambientIntensity; // We show the ambient light
-					} else {
-						isIntersected = false;
-						isInCircle = false;
-						for (auto &obstacle : obstacles) {
-
-							if (isPointInCircle(currentPixel, obstacle))
-							{
-								isIntersected = true;
-								isInCircle = true;
-								break;
-							}
-
-							if (showShadows > 0)
-							{
-								if (areIntersected(line(currentPixel, lightPosition), obstacle))
-								{
-									auto interBetweenLightAndObstacle = getIntersection(line(currentPixel, lightPosition), obstacle);
-									auto frontPoint = getFirstPointFromPointPair(interBetweenLightAndObstacle);
-									auto backPoint = getSecondPointFromPointPair(interBetweenLightAndObstacle);
-
-									// BASIC SHADOWS
-									// Detect if the pixel is in shadow of an obstacle
-									if (distance(currentPixel, lightPosition) >= distance(currentPixel, frontPoint))
-									{
-										if (distance(projectPointOnCircle(currentPixel, obstacle), lightPosition) <= distance(currentPixel, lightPosition))
-										{
-											isIntersected = true;
-										}
-									}
-
-
-									// // ADVANCED SHADOWS
-									if (showShadows == 2) {
-										// Detect if the pixel is in the shadow near the obstacle
-										distanceFromBackPoint = distance(backPoint, currentPixel);
-										if (distanceFromBackPoint < 25.f)
-										{
-											closeToCircle = true;
-											lessDistanceFromBackPoint = distanceFromBackPoint;
-										}
-									}
-								}
-							}
-						}
-
-						intensity = easeIn(1.f - (distanceFromLight / mainLight.size()), ambientIntensity, 1.f, 1.5f);
-
-						if (isIntersected) {
-							if (isInCircle) {
-								// The pixel is in a circle
-								intensity = easeIn(1.f - (distanceFromLight / mainLight.size()), inObstacleColor, ambientIntensity, 1.f);
-								intensity = lerp(ambientIntensity, intensity, 1.f - (distanceFromLight / mainLight.size()));
-							} else {
-								// The pixel is not is behind a circle
-								intensity = ambientIntensity;
-								if (closeToCircle) {
-									intensity = lerp(ambientIntensity * .7f, ambientIntensity, lessDistanceFromBackPoint / 25.f);
-								}
-							}
-						} else {
-							if (closeToCircle) {
-								// intensity = lerp(ambientIntensity, intensity, 1.f - (distanceFromLight / mainLight.size()));
-								intensity = easeIn(1.f - lessDistanceFromBackPoint / 30.f, intensity, 1.f, 1.f);
-							}
-						}
-					}
-					pixelsColors[idx] = glm::vec4(intensity, intensity, intensity, 1.); // RGBA
-				}
-
-				offsetStart = offsetEnd + 1;
-				offsetEnd = offsetStart + nbPixelsToDraw;
-				if (offsetEnd > nbPixelsTotal) {
-					offsetEnd = nbPixelsTotal;
-				}
-			} else {
-				drawn = true;
-			}
-		}
+		if (!renderer.isComplete())
+			renderer.render(pixelsColors.data(), nbPixelsToDraw);
 
 		// Update texture
 		glBindTexture(GL_TEXTURE_2D, texture);